@@ -0,0 +1,56 @@
+/**
+ * @file concurrency.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/concurrent-y-fast-trie/concurrent-y-fast-trie.h"
+#include <shared_mutex>
+#include <mutex>
+
+/**
+ * @brief Baseline that guards a whole YFastTrie with a single reader writer lock.
+ * 
+ * @tparam Key_ is the key type.
+ */
+template <typename Key_>
+class GlobalLockYFastTrie {
+public:
+    using key_type = Key_;
+
+private:
+    using trie_type = YFastTrie<key_type, SortedArrayBucket<key_type>>;
+
+    trie_type trie_;
+    mutable std::shared_mutex mutex_;
+
+public:
+    static constexpr key_type upper_bound() { return trie_type::upper_bound(); }
+
+    bool contains(key_type key) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return trie_.contains(key);
+    }
+
+    auto successor(key_type key) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return trie_.successor(key);
+    }
+
+    void insert(key_type key) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        trie_.insert(key);
+    }
+
+    void remove(key_type key) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        trie_.remove(key);
+    }
+};
+
+DEFINE_CONCURRENCY_BENCHMARKS(ConcurrentYFastTrie);
+DEFINE_CONCURRENCY_BENCHMARKS(GlobalLockYFastTrie);
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -17,3 +17,9 @@ constexpr uint64_t RANGE_LOWER_BOUND = (1 << 4);
 
 // Input size to end benchmarking on.
 constexpr uint64_t RANGE_UPPER_BOUND = (1 << 16);
+
+// Number of queries answered per batch.
+constexpr uint64_t BATCH_SIZE        = (1 << 10);
+
+// Largest number of threads for concurrent benchmarks.
+constexpr uint64_t MAX_THREADS       = 32;
@@ -0,0 +1,128 @@
+/**
+ * @file latency-histogram.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Histogram of operation latencies with bounded relative error.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+/**
+ * @brief Histogram of latencies in nanoseconds, laid out like an HDR histogram. Each power of two
+ * is split into the same number of linear sub-buckets, so recording a value is a few shifts and an
+ * increment, the histogram has a fixed size for the whole range of 64-bit values, and every
+ * reported percentile is within about 3% of the recorded value. The maximum is tracked exactly.
+ *
+ */
+class LatencyHistogram {
+public:
+    using value_type = uint64_t;
+    using size_type = size_t;
+
+private:
+    // Base 2 logarithm of the number of sub-buckets per power of two.
+    static constexpr size_type sub_bucket_bits_ = 5;
+
+    // Number of sub-buckets per power of two.
+    static constexpr size_type sub_bucket_count_ = static_cast<size_type>(1) << sub_bucket_bits_;
+
+    // Values below twice the number of sub-buckets are counted exactly.
+    static constexpr size_type bucket_count_ = (64 - sub_bucket_bits_ + 1) * sub_bucket_count_;
+
+    std::array<uint64_t, bucket_count_> counts_;
+    uint64_t total_count_;
+    value_type max_;
+
+    /**
+     * @brief Get the bucket of a value.
+     *
+     * @param value to find the bucket of.
+     * @return index of the bucket.
+     */
+    static size_type bucket(value_type value) noexcept {
+        if (value < 2 * sub_bucket_count_) return value;
+        size_type shift = (63 - __builtin_clzll(value)) - sub_bucket_bits_;
+        return (shift + 1) * sub_bucket_count_ + ((value >> shift) - sub_bucket_count_);
+    }
+
+    /**
+     * @brief Get the largest value that falls in a bucket.
+     *
+     * @param index of the bucket.
+     * @return the largest value of the bucket.
+     */
+    static value_type highest_value(size_type index) noexcept {
+        if (index < 2 * sub_bucket_count_) return index;
+        size_type shift = index / sub_bucket_count_ - 1;
+        value_type sub_bucket = index % sub_bucket_count_ + sub_bucket_count_;
+        return ((sub_bucket + 1) << shift) - 1;
+    }
+
+public:
+    LatencyHistogram() {
+        clear();
+    }
+
+    /**
+     * @brief Record a latency.
+     *
+     * @param value of the latency in nanoseconds.
+     */
+    void record(value_type value) noexcept {
+        counts_[bucket(value)] += 1;
+        total_count_ += 1;
+        max_ = std::max(max_, value);
+    }
+
+    /**
+     * @brief Get the number of recorded latencies.
+     *
+     * @return number of recorded latencies.
+     */
+    uint64_t count() const noexcept {
+        return total_count_;
+    }
+
+    /**
+     * @brief Get the largest recorded latency.
+     *
+     * @return the largest latency, or 0 if nothing was recorded.
+     */
+    value_type max() const noexcept {
+        return max_;
+    }
+
+    /**
+     * @brief Get the latency that a given percentage of the recorded latencies do not exceed.
+     *
+     * @param percentile between 0 and 100.
+     * @return the latency at the percentile, or 0 if nothing was recorded.
+     */
+    value_type percentile(double percentile) const noexcept {
+        if (total_count_ == 0) return 0;
+        auto rank = static_cast<uint64_t>(percentile / 100.0 * total_count_ + 0.5);
+        rank = std::min(std::max<uint64_t>(rank, 1), total_count_);
+        uint64_t seen = 0;
+        for (size_type i = 0; i < bucket_count_; ++i) {
+            seen += counts_[i];
+            if (seen >= rank) return std::min(highest_value(i), max_);
+        }
+        return max_;
+    }
+
+    /**
+     * @brief Forget every recorded latency.
+     *
+     */
+    void clear() noexcept {
+        counts_.fill(0);
+        total_count_ = 0;
+        max_ = 0;
+    }
+};
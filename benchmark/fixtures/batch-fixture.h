@@ -0,0 +1,69 @@
+/**
+ * @file batch-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for the batch operations.
+ * @version 1.0
+ * @date 2026-10-16
+ * 
+ */
+
+#pragma once
+#include "base/full-base-fixture.h"
+#include "base/constants.h"
+#include <vector>
+#include <optional>
+#include <memory>
+
+template <typename Obj_>
+class BatchFixture : public FullBaseFixture<Obj_> { 
+protected:
+    using key_type = typename Obj_::key_type;
+    using some_key_type = std::optional<key_type>;
+
+    std::vector<key_type> queries_;
+
+    void SetUp(const benchmark::State& state) override {
+        FullBaseFixture<Obj_>::SetUp(state);
+        queries_.clear();
+        for (uint64_t i = 0; i < BATCH_SIZE; ++i)
+            queries_.push_back(std::rand() % this->obj_.upper_bound());
+    }
+
+    virtual void BM_contains_batch(benchmark::State& state) {
+        std::unique_ptr<bool[]> results(new bool[BATCH_SIZE]);
+        for (auto _ : state) {
+            this->obj_.contains_batch(queries_.data(), BATCH_SIZE, results.get());
+            benchmark::DoNotOptimize(results.get());
+        }
+        state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+    }
+
+    virtual void BM_predecessor_batch(benchmark::State& state) {
+        std::vector<some_key_type> results(BATCH_SIZE);
+        for (auto _ : state) {
+            this->obj_.predecessor_batch(queries_.data(), BATCH_SIZE, results.data());
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+    }
+
+    virtual void BM_successor_batch(benchmark::State& state) {
+        std::vector<some_key_type> results(BATCH_SIZE);
+        for (auto _ : state) {
+            this->obj_.successor_batch(queries_.data(), BATCH_SIZE, results.data());
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+    }
+
+    // Answers the same queries one at a time, as a baseline for the batch operations.
+    virtual void BM_successor_sequential(benchmark::State& state) {
+        std::vector<some_key_type> results(BATCH_SIZE);
+        for (auto _ : state) {
+            for (uint64_t i = 0; i < BATCH_SIZE; ++i)
+                results[i] = this->obj_.successor(queries_[i]);
+            benchmark::DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+    }
+};
\ No newline at end of file
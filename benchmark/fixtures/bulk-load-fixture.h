@@ -0,0 +1,47 @@
+/**
+ * @file bulk-load-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for construction from a sorted range.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include <vector>
+#include <algorithm>
+
+template <typename Obj_>
+class BulkLoadFixture : public EmptyBaseFixture<Obj_> { 
+protected:
+    using key_type = typename Obj_::key_type;
+
+    std::vector<key_type> keys_;
+
+    void SetUp(const benchmark::State& state) override {
+        EmptyBaseFixture<Obj_>::SetUp(state);
+        keys_.clear();
+        for (int i = 0; i < state.range(0); ++i)
+            keys_.push_back(std::rand() % Obj_::upper_bound());
+        std::sort(keys_.begin(), keys_.end());
+    }
+
+    virtual void BM_bulk_load(benchmark::State& state) {
+        for (auto _ : state) {
+            Obj_ obj(keys_.begin(), keys_.end());
+            benchmark::DoNotOptimize(obj);
+        }
+    }
+
+    // Inserts the same sorted keys one at a time, as a baseline for the bulk load.
+    virtual void BM_sorted_insert(benchmark::State& state) {
+        for (auto _ : state) {
+            Obj_ obj;
+            benchmark::DoNotOptimize(obj);
+            for (auto key : keys_)
+                obj.insert(key);
+            benchmark::ClobberMemory();
+        }
+    }
+};
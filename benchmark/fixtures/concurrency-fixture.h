@@ -0,0 +1,44 @@
+/**
+ * @file concurrency-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for concurrent access.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/full-base-fixture.h"
+#include <random>
+
+template <typename Obj_>
+class ConcurrencyFixture : public FullBaseFixture<Obj_> { 
+protected:
+    void SetUp(const benchmark::State& state) override {
+        // Every thread runs the set up, but the object is shared, so only one thread fills it.
+        // The other threads wait for it at the start of the benchmark loop.
+        if (state.thread_index() == 0)
+            FullBaseFixture<Obj_>::SetUp(state);
+    }
+
+    virtual void BM_concurrent_contains(benchmark::State& state) {
+        std::mt19937_64 mte(state.thread_index());
+        for (auto _ : state) {
+            auto key = mte() % this->obj_.upper_bound();
+            benchmark::DoNotOptimize(this->obj_.contains(key));
+        }
+    }
+
+    virtual void BM_concurrent_mixed(benchmark::State& state) {
+        // One in ten operations is an update, split evenly between inserts and removes so that
+        // the number of keys stays about the same.
+        std::mt19937_64 mte(state.thread_index());
+        for (auto _ : state) {
+            auto key = mte() % this->obj_.upper_bound();
+            auto operation = mte() % 20;
+            if (operation == 0) this->obj_.insert(key);
+            else if (operation == 1) this->obj_.remove(key);
+            else benchmark::DoNotOptimize(this->obj_.successor(key));
+        }
+    }
+};
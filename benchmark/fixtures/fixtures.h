@@ -18,6 +18,18 @@
 #include "insert-fixture.h"
 #include "remove-fixture.h"
 #include "performance-fixture.h"
+#include "batch-fixture.h"
+#include "bulk-load-fixture.h"
+#include "iterator-fixture.h"
+#include "range-fixture.h"
+#include "order-statistic-fixture.h"
+#include "concurrency-fixture.h"
+#include "map-fixture.h"
+#include "multiset-fixture.h"
+#include "serialization-fixture.h"
+#include "frozen-fixture.h"
+#include "memory-fixture.h"
+#include "latency-fixture.h"
 
 #define DEFINE_BENCHMARK_HELPER(OBJ_TYPE, KEY_TYPE, FIXTURE_NAME, METHOD_NAME) \
 BENCHMARK_TEMPLATE_DEFINE_F(FIXTURE_NAME, METHOD_NAME ## _ ## KEY_TYPE, OBJ_TYPE<KEY_TYPE>) (benchmark::State& state) { \
@@ -54,3 +66,95 @@ BENCHMARK_REGISTER_F(FIXTURE_NAME, METHOD_NAME ## _ ## KEY_TYPE)->RangeMultiplie
 
 #define DEFINE_PERFORMANCE_BENCHMARKS(OBJ_TYPE) \
     DEFINE_BENCHMARK_HELPER(OBJ_TYPE, uint64_t, PerformanceFixture, BM_performance);
+
+#define DEFINE_BATCH_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, BatchFixture, BM_contains_batch); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, BatchFixture, BM_predecessor_batch); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, BatchFixture, BM_successor_batch); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, BatchFixture, BM_successor_sequential);
+
+#define DEFINE_BULK_LOAD_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, BulkLoadFixture, BM_bulk_load); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, BulkLoadFixture, BM_sorted_insert);
+
+#define DEFINE_SERIALIZATION_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, SerializationFixture, BM_save); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, SerializationFixture, BM_load);
+
+#define DEFINE_FROZEN_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, FrozenFixture, BM_frozen_contains); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, FrozenFixture, BM_frozen_successor); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, FrozenFixture, BM_attach);
+
+#define DEFINE_ITERATOR_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, IteratorFixture, BM_iterate); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, IteratorFixture, BM_successor_scan);
+
+#define DEFINE_RANGE_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, RangeFixture, BM_count_range); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, RangeFixture, BM_for_each_in_range); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, RangeFixture, BM_successor_range);
+
+#define DEFINE_ORDER_STATISTIC_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, OrderStatisticFixture, BM_rank); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, OrderStatisticFixture, BM_select);
+
+#define DEFINE_MAP_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, MapFixture, BM_find); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, MapFixture, BM_successor_entry); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, MapFixture, BM_insert_or_assign);
+
+#define DEFINE_MULTISET_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, MultisetFixture, BM_count); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, MultisetFixture, BM_insert_remove);
+
+#define DEFINE_MEMORY_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, MemoryFixture, BM_memory);
+
+#define DEFINE_LATENCY_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, LatencyFixture, BM_insert_latency); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, LatencyFixture, BM_remove_latency); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, LatencyFixture, BM_contains_latency); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, LatencyFixture, BM_successor_latency); \
+    DEFINE_BENCHMARKS_HELPER(OBJ_TYPE, LatencyFixture, BM_predecessor_latency);
+
+// The name of the object is part of the benchmark name, so that a baseline can be registered
+// in the same file.
+#define DEFINE_THREADED_BENCHMARK_HELPER(OBJ_TYPE, KEY_TYPE, FIXTURE_NAME, METHOD_NAME) \
+BENCHMARK_TEMPLATE_DEFINE_F(FIXTURE_NAME, METHOD_NAME ## _ ## OBJ_TYPE ## _ ## KEY_TYPE, OBJ_TYPE<KEY_TYPE>) (benchmark::State& state) { \
+	FIXTURE_NAME::METHOD_NAME(state); \
+} \
+BENCHMARK_REGISTER_F(FIXTURE_NAME, METHOD_NAME ## _ ## OBJ_TYPE ## _ ## KEY_TYPE)->Arg(RANGE_UPPER_BOUND)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+
+#define DEFINE_THREADED_BENCHMARKS_HELPER(OBJ_TYPE, FIXTURE_NAME, METHOD_NAME) \
+    DEFINE_THREADED_BENCHMARK_HELPER(OBJ_TYPE, uint64_t, FIXTURE_NAME, METHOD_NAME) \
+    DEFINE_THREADED_BENCHMARK_HELPER(OBJ_TYPE, uint32_t, FIXTURE_NAME, METHOD_NAME);
+
+#define DEFINE_CONCURRENCY_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_THREADED_BENCHMARKS_HELPER(OBJ_TYPE, ConcurrencyFixture, BM_concurrent_contains); \
+    DEFINE_THREADED_BENCHMARKS_HELPER(OBJ_TYPE, ConcurrencyFixture, BM_concurrent_mixed);
+
+#define DEFINE_MAP_BENCHMARK_HELPER(OBJ_TYPE, MAP_TYPE, KEY_TYPE, FIXTURE_NAME, METHOD_NAME) \
+BENCHMARK_TEMPLATE_DEFINE_F(FIXTURE_NAME, METHOD_NAME ## _ ## MAP_TYPE ## _ ## KEY_TYPE, OBJ_TYPE<KEY_TYPE, MAP_TYPE>) (benchmark::State& state) { \
+	FIXTURE_NAME::METHOD_NAME(state); \
+} \
+BENCHMARK_REGISTER_F(FIXTURE_NAME, METHOD_NAME ## _ ## MAP_TYPE ## _ ## KEY_TYPE)->RangeMultiplier(RANGE_MULTIPLER)->Range(RANGE_LOWER_BOUND, RANGE_UPPER_BOUND);
+
+#define DEFINE_MAP_BENCHMARKS_HELPER(OBJ_TYPE, MAP_TYPE, FIXTURE_NAME, METHOD_NAME) \
+    DEFINE_MAP_BENCHMARK_HELPER(OBJ_TYPE, MAP_TYPE, uint64_t, FIXTURE_NAME, METHOD_NAME) \
+    DEFINE_MAP_BENCHMARK_HELPER(OBJ_TYPE, MAP_TYPE, uint32_t, FIXTURE_NAME, METHOD_NAME) \
+    DEFINE_MAP_BENCHMARK_HELPER(OBJ_TYPE, MAP_TYPE, uint16_t, FIXTURE_NAME, METHOD_NAME) \
+    DEFINE_MAP_BENCHMARK_HELPER(OBJ_TYPE, MAP_TYPE, uint8_t, FIXTURE_NAME, METHOD_NAME);
+
+// OBJ_TYPE must be a template of the form OBJ_TYPE<Key, Map>. Call this once per hash table
+// policy to benchmark the policies side by side.
+#define DEFINE_MAP_POLICY_BENCHMARKS(OBJ_TYPE, MAP_TYPE) \
+    DEFINE_MAP_BENCHMARKS_HELPER(OBJ_TYPE, MAP_TYPE, ContainsFixture, BM_contains); \
+    DEFINE_MAP_BENCHMARKS_HELPER(OBJ_TYPE, MAP_TYPE, PredecessorFixture, BM_predecessor); \
+    DEFINE_MAP_BENCHMARKS_HELPER(OBJ_TYPE, MAP_TYPE, SuccessorFixture, BM_successor); \
+    DEFINE_MAP_BENCHMARKS_HELPER(OBJ_TYPE, MAP_TYPE, InsertFixture, BM_insert); \
+    DEFINE_MAP_BENCHMARKS_HELPER(OBJ_TYPE, MAP_TYPE, RemoveFixture, BM_remove);
+
+#define DEFINE_ALL_MAP_POLICY_BENCHMARKS(OBJ_TYPE) \
+    DEFINE_MAP_POLICY_BENCHMARKS(OBJ_TYPE, map_wrapper); \
+    DEFINE_MAP_POLICY_BENCHMARKS(OBJ_TYPE, flat_map);
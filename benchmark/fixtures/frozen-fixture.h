@@ -0,0 +1,54 @@
+/**
+ * @file frozen-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for read-only tries built from an image.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include <vector>
+#include <algorithm>
+
+template <typename Obj_>
+class FrozenFixture : public EmptyBaseFixture<Obj_> { 
+protected:
+    using key_type = typename Obj_::key_type;
+
+    typename Obj_::image_type image_;
+    Obj_ obj_;
+
+    void SetUp(const benchmark::State& state) override {
+        EmptyBaseFixture<Obj_>::SetUp(state);
+        std::vector<key_type> keys;
+        for (int i = 0; i < state.range(0); ++i)
+            keys.push_back(std::rand() % Obj_::upper_bound());
+        std::sort(keys.begin(), keys.end());
+        image_ = Obj_::build(keys.begin(), keys.end());
+        obj_.attach(image_.data(), image_.size());
+    }
+
+    virtual void BM_frozen_contains(benchmark::State& state) {
+        for (auto _ : state) {
+            auto key = std::rand() % Obj_::upper_bound();
+            benchmark::DoNotOptimize(obj_.contains(key));
+        }
+    }
+
+    virtual void BM_frozen_successor(benchmark::State& state) {
+        for (auto _ : state) {
+            auto key = std::rand() % Obj_::upper_bound();
+            benchmark::DoNotOptimize(obj_.successor(key));
+        }
+    }
+
+    // Attaching only reads the header, so it should not depend on the number of keys.
+    virtual void BM_attach(benchmark::State& state) {
+        for (auto _ : state) {
+            Obj_ obj;
+            benchmark::DoNotOptimize(obj.attach(image_.data(), image_.size()));
+        }
+    }
+};
@@ -0,0 +1,32 @@
+/**
+ * @file iterator-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for the iterators.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/full-base-fixture.h"
+
+template <typename Obj_>
+class IteratorFixture : public FullBaseFixture<Obj_> { 
+protected:
+    virtual void BM_iterate(benchmark::State& state) {
+        for (auto _ : state) {
+            for (auto key : this->obj_)
+                benchmark::DoNotOptimize(key);
+        }
+        state.SetItemsProcessed(state.iterations() * this->obj_.size());
+    }
+
+    // Visits the same keys with repeated successor queries, as a baseline for the iterators.
+    virtual void BM_successor_scan(benchmark::State& state) {
+        for (auto _ : state) {
+            for (auto key = this->obj_.min(); key.has_value(); key = this->obj_.successor(key.value()))
+                benchmark::DoNotOptimize(key);
+        }
+        state.SetItemsProcessed(state.iterations() * this->obj_.size());
+    }
+};
@@ -0,0 +1,172 @@
+/**
+ * @file latency-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for the latency distribution of single operations.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/latency-histogram.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Times every operation on its own with a steady clock and reports percentiles of the
+ * latencies, so that rare slow operations such as bucket splits and merges show up even when
+ * they do not move the mean. Inserts are timed one after another as the object grows, and
+ * removes as it shrinks, so the splits and merges they cause are timed with them. After each batch
+ * the object is brought back to its starting keys without timing. Every latency includes a call
+ * to the clock, which takes a few tens of nanoseconds.
+ *
+ * @tparam Obj_ to benchmark.
+ */
+template <typename Obj_>
+class LatencyFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+    using clock_type = std::chrono::steady_clock;
+
+    // Number of keys that are not in the object to draw insertions from.
+    static constexpr int absent_key_count_ = 1 << 12;
+
+    std::unique_ptr<Obj_> obj_;
+    std::vector<key_type> keys_;
+    std::vector<key_type> absent_keys_;
+    std::mt19937_64 mte_;
+
+    void SetUp(const benchmark::State& state) override {
+        EmptyBaseFixture<Obj_>::SetUp(state);
+        obj_ = std::make_unique<Obj_>();
+        keys_.clear();
+        for (int i = 0; i < state.range(0); ++i) {
+            auto key = static_cast<key_type>(std::rand() % Obj_::upper_bound());
+            if (obj_->contains(key)) continue;
+            obj_->insert(key);
+            keys_.push_back(key);
+        }
+
+        // The keys to insert are drawn up front, since checking a key right before inserting it
+        // would bring its path into the cache.
+        absent_keys_.clear();
+        for (int i = 0; i < 4 * absent_key_count_ && absent_keys_.size() < absent_key_count_; ++i) {
+            auto key = static_cast<key_type>(std::rand() % Obj_::upper_bound());
+            if (!obj_->contains(key)) absent_keys_.push_back(key);
+        }
+    }
+
+    void TearDown(const benchmark::State& state) override {
+        obj_.reset();
+    }
+
+    /**
+     * @brief Time an operation.
+     *
+     * @param histogram to record the latency in.
+     * @param operation to time.
+     */
+    template <typename Operation_>
+    static void time_operation(LatencyHistogram& histogram, Operation_&& operation) {
+        auto start = clock_type::now();
+        operation();
+        benchmark::ClobberMemory();
+        auto end = clock_type::now();
+        histogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    /**
+     * @brief Report the percentiles of the latencies as counters.
+     *
+     * @param state of the benchmark.
+     * @param histogram of the latencies.
+     */
+    static void report(benchmark::State& state, const LatencyHistogram& histogram) {
+        state.counters["p50_ns"] = histogram.percentile(50.0);
+        state.counters["p99_ns"] = histogram.percentile(99.0);
+        state.counters["p99.9_ns"] = histogram.percentile(99.9);
+        state.counters["max_ns"] = histogram.max();
+    }
+
+    // Inserts batches of keys that are not in the object, which grows by up to its starting size
+    // in each batch. The keys of a batch are removed again without timing.
+    virtual void BM_insert_latency(benchmark::State& state) {
+        LatencyHistogram histogram;
+        if (absent_keys_.empty()) {
+            state.SkipWithError("Every key is in the object.");
+            return;
+        }
+        auto batch_size = std::min(absent_keys_.size(), std::max(keys_.size(), size_t(1)));
+        size_t inserted = 0;
+        for (auto _ : state) {
+            if (inserted == batch_size) {
+                state.PauseTiming();
+                for (size_t i = 0; i < inserted; ++i)
+                    obj_->remove(absent_keys_[i]);
+                std::shuffle(absent_keys_.begin(), absent_keys_.end(), mte_);
+                inserted = 0;
+                state.ResumeTiming();
+            }
+            auto key = absent_keys_[inserted++];
+            time_operation(histogram, [&] { obj_->insert(key); });
+        }
+        report(state, histogram);
+    }
+
+    // Removes batches of keys of the object, which shrinks to half of its starting size in each
+    // batch. The keys of a batch are inserted again without timing.
+    virtual void BM_remove_latency(benchmark::State& state) {
+        LatencyHistogram histogram;
+        if (keys_.empty()) {
+            state.SkipWithError("The object is empty.");
+            return;
+        }
+        auto batch_size = std::max(keys_.size() / 2, size_t(1));
+        std::shuffle(keys_.begin(), keys_.end(), mte_);
+        size_t removed = 0;
+        for (auto _ : state) {
+            if (removed == batch_size) {
+                state.PauseTiming();
+                for (size_t i = 0; i < removed; ++i)
+                    obj_->insert(keys_[i]);
+                std::shuffle(keys_.begin(), keys_.end(), mte_);
+                removed = 0;
+                state.ResumeTiming();
+            }
+            auto key = keys_[removed++];
+            time_operation(histogram, [&] { obj_->remove(key); });
+        }
+        report(state, histogram);
+    }
+
+    virtual void BM_contains_latency(benchmark::State& state) {
+        LatencyHistogram histogram;
+        for (auto _ : state) {
+            auto key = static_cast<key_type>(std::rand() % Obj_::upper_bound());
+            time_operation(histogram, [&] { benchmark::DoNotOptimize(obj_->contains(key)); });
+        }
+        report(state, histogram);
+    }
+
+    virtual void BM_successor_latency(benchmark::State& state) {
+        LatencyHistogram histogram;
+        for (auto _ : state) {
+            auto key = static_cast<key_type>(std::rand() % Obj_::upper_bound());
+            time_operation(histogram, [&] { benchmark::DoNotOptimize(obj_->successor(key)); });
+        }
+        report(state, histogram);
+    }
+
+    virtual void BM_predecessor_latency(benchmark::State& state) {
+        LatencyHistogram histogram;
+        for (auto _ : state) {
+            auto key = static_cast<key_type>(std::rand() % Obj_::upper_bound());
+            time_operation(histogram, [&] { benchmark::DoNotOptimize(obj_->predecessor(key)); });
+        }
+        report(state, histogram);
+    }
+};
@@ -0,0 +1,49 @@
+/**
+ * @file map-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for ordered maps.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+
+template <typename Obj_>
+class MapFixture : public benchmark::Fixture { 
+protected:
+    void SetUp(const benchmark::State& state) override {
+        std::srand(0);
+        for (int i = 0; i < state.range(0); ++i) {
+            auto key = std::rand() % obj_.upper_bound();
+            obj_.insert_or_assign(key, key);
+        }
+    }
+
+    virtual void BM_find(benchmark::State& state) {
+        for (auto _ : state) {
+            auto key = std::rand() % this->obj_.upper_bound();
+            auto value = this->obj_.find(key);
+            benchmark::DoNotOptimize(value != nullptr ? *value : 0);
+        }
+    }
+
+    virtual void BM_successor_entry(benchmark::State& state) {
+        for (auto _ : state) {
+            auto key = std::rand() % this->obj_.upper_bound();
+            auto entry = this->obj_.successor_entry(key);
+            benchmark::DoNotOptimize(entry ? *entry->second : 0);
+        }
+    }
+
+    virtual void BM_insert_or_assign(benchmark::State& state) {
+        for (auto _ : state) {
+            auto key = std::rand() % this->obj_.upper_bound();
+            this->obj_.insert_or_assign(key, key);
+        }
+    }
+
+    Obj_ obj_;
+};
@@ -0,0 +1,33 @@
+/**
+ * @file memory-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for memory usage.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+
+template <typename Obj_>
+class MemoryFixture : public EmptyBaseFixture<Obj_> { 
+protected:
+    // Times the memory accounting itself and reports the memory of the keys as counters.
+    virtual void BM_memory(benchmark::State& state) {
+        Obj_ obj;
+        for (int i = 0; i < state.range(0); ++i)
+            obj.insert(std::rand() % Obj_::upper_bound());
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(obj.memory_usage());
+
+        auto breakdown = obj.memory_breakdown();
+        auto size = static_cast<double>(obj.size());
+        state.counters["bytes_per_key"] = breakdown.total() / size;
+        state.counters["nodes_per_key"] = breakdown.nodes / size;
+        state.counters["tables_per_key"] = breakdown.tables / size;
+        state.counters["partitions_per_key"] = breakdown.partitions / size;
+        state.counters["slack_per_key"] = breakdown.slack / size;
+    }
+};
@@ -0,0 +1,41 @@
+/**
+ * @file multiset-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for ordered multisets.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+
+template <typename Obj_>
+class MultisetFixture : public benchmark::Fixture { 
+protected:
+    void SetUp(const benchmark::State& state) override {
+        std::srand(0);
+
+        // Every key is inserted about four times.
+        for (int i = 0; i < state.range(0); ++i)
+            obj_.insert(std::rand() % (state.range(0) / 4 + 1));
+    }
+
+    virtual void BM_count(benchmark::State& state) {
+        for (auto _ : state) {
+            auto key = std::rand() % (state.range(0) / 4 + 1);
+            benchmark::DoNotOptimize(this->obj_.count(key));
+        }
+    }
+
+    virtual void BM_insert_remove(benchmark::State& state) {
+        for (auto _ : state) {
+            auto key = std::rand() % (state.range(0) / 4 + 1);
+            this->obj_.insert(key);
+            this->obj_.remove(key);
+        }
+    }
+
+    Obj_ obj_;
+};
@@ -0,0 +1,29 @@
+/**
+ * @file order-statistic-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for rank and select.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/full-base-fixture.h"
+
+template <typename Obj_>
+class OrderStatisticFixture : public FullBaseFixture<Obj_> { 
+protected:
+    virtual void BM_rank(benchmark::State& state) {
+        for (auto _ : state) {
+            auto key = std::rand() % this->obj_.upper_bound();
+            benchmark::DoNotOptimize(this->obj_.rank(key));
+        }
+    }
+
+    virtual void BM_select(benchmark::State& state) {
+        for (auto _ : state) {
+            auto index = std::rand() % this->obj_.size();
+            benchmark::DoNotOptimize(this->obj_.select(index));
+        }
+    }
+};
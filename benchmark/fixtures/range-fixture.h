@@ -0,0 +1,50 @@
+/**
+ * @file range-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for the range queries.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/full-base-fixture.h"
+#include <optional>
+
+template <typename Obj_>
+class RangeFixture : public FullBaseFixture<Obj_> { 
+protected:
+    using key_type = typename Obj_::key_type;
+
+    // Each range covers a sixteenth of the universe.
+    static constexpr key_type range_width_ = Obj_::upper_bound() / 16;
+
+    key_type low_;
+
+    void SetUp(const benchmark::State& state) override {
+        FullBaseFixture<Obj_>::SetUp(state);
+        low_ = std::rand() % (Obj_::upper_bound() - range_width_);
+    }
+
+    virtual void BM_count_range(benchmark::State& state) {
+        for (auto _ : state)
+            benchmark::DoNotOptimize(this->obj_.count_range(low_, low_ + range_width_));
+    }
+
+    virtual void BM_for_each_in_range(benchmark::State& state) {
+        for (auto _ : state)
+            this->obj_.for_each_in_range(low_, low_ + range_width_, [](key_type key) {
+                benchmark::DoNotOptimize(key);
+            });
+    }
+
+    // Visits the same keys with repeated successor queries, as a baseline for the range queries.
+    virtual void BM_successor_range(benchmark::State& state) {
+        for (auto _ : state) {
+            key_type high = low_ + range_width_;
+            auto key = this->obj_.contains(low_) ? std::optional<key_type>(low_) : this->obj_.successor(low_);
+            for (; key.has_value() && key.value() <= high; key = this->obj_.successor(key.value()))
+                benchmark::DoNotOptimize(key);
+        }
+    }
+};
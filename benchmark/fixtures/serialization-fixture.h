@@ -0,0 +1,48 @@
+/**
+ * @file serialization-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Benchmark fixture for saving and loading.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include <sstream>
+#include <string>
+
+template <typename Obj_>
+class SerializationFixture : public EmptyBaseFixture<Obj_> { 
+protected:
+    std::string data_;
+
+    void SetUp(const benchmark::State& state) override {
+        EmptyBaseFixture<Obj_>::SetUp(state);
+        for (int i = 0; i < state.range(0); ++i)
+            obj_.insert(std::rand() % Obj_::upper_bound());
+        std::ostringstream os(std::ios::binary);
+        obj_.save(os);
+        data_ = os.str();
+    }
+
+    virtual void BM_save(benchmark::State& state) {
+        for (auto _ : state) {
+            std::ostringstream os(std::ios::binary);
+            obj_.save(os);
+            benchmark::DoNotOptimize(os);
+        }
+        state.SetBytesProcessed(state.iterations() * data_.size());
+    }
+
+    virtual void BM_load(benchmark::State& state) {
+        for (auto _ : state) {
+            std::istringstream is(data_, std::ios::binary);
+            Obj_ obj;
+            benchmark::DoNotOptimize(obj.load(is));
+        }
+        state.SetBytesProcessed(state.iterations() * data_.size());
+    }
+
+    Obj_ obj_;
+};
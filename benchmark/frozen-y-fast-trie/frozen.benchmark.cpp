@@ -0,0 +1,13 @@
+/**
+ * @file frozen.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/frozen-y-fast-trie/frozen-y-fast-trie.h"
+
+DEFINE_FROZEN_BENCHMARKS(FrozenYFastTrie);
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,13 @@
+/**
+ * @file order-statistic.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/red-black-tree/red-black-tree.h"
+
+DEFINE_ORDER_STATISTIC_BENCHMARKS(RedBlackTree);
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,15 @@
+/**
+ * @file concurrency.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/sharded-y-fast-trie/sharded-y-fast-trie.h"
+#include "../../src/concurrent-y-fast-trie/concurrent-y-fast-trie.h"
+
+DEFINE_CONCURRENCY_BENCHMARKS(ShardedYFastTrie);
+DEFINE_CONCURRENCY_BENCHMARKS(ConcurrentYFastTrie);
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,13 @@
+/**
+ * @file latency.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/x-fast-trie/x-fast-trie.h"
+
+DEFINE_LATENCY_BENCHMARKS(XFastTrie);
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,53 @@
+/**
+ * @file hash-table-map.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-trie/y-fast-trie.h"
+#include "../../src/sorted-array-bucket/sorted-array-bucket.h"
+#include <unordered_map>
+#include <optional>
+#include <limits>
+#include <utility>
+
+/**
+ * @brief Baseline that keeps the values in a hash table next to a YFastTrie of the keys.
+ * 
+ * @tparam Key_ is the key type.
+ */
+template <typename Key_>
+class HashTableYFastMap {
+public:
+    using key_type = Key_;
+    using entry_type = std::pair<key_type, uint64_t*>;
+
+private:
+    YFastTrie<key_type, SortedArrayBucket<key_type>> trie_;
+    std::unordered_map<key_type, uint64_t> values_;
+
+public:
+    static constexpr key_type upper_bound() { return std::numeric_limits<key_type>::max(); }
+
+    uint64_t* find(key_type key) {
+        auto it = values_.find(key);
+        return it == values_.end() ? nullptr : &it->second;
+    }
+
+    std::optional<entry_type> successor_entry(key_type key) {
+        auto successor = trie_.successor(key);
+        if (!successor) return std::nullopt;
+        return entry_type(*successor, &values_.find(*successor)->second);
+    }
+
+    void insert_or_assign(key_type key, uint64_t value) {
+        trie_.insert(key);
+        values_[key] = value;
+    }
+};
+
+DEFINE_MAP_BENCHMARKS(HashTableYFastMap);
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,16 @@
+/**
+ * @file map.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-map/y-fast-map.h"
+
+template <typename Key_>
+using Uint64YFastMap = YFastMap<Key_, uint64_t>;
+
+DEFINE_MAP_BENCHMARKS(Uint64YFastMap);
+BENCHMARK_MAIN();
\ No newline at end of file
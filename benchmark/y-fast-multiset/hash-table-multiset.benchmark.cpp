@@ -0,0 +1,50 @@
+/**
+ * @file hash-table-multiset.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-trie/y-fast-trie.h"
+#include "../../src/sorted-array-bucket/sorted-array-bucket.h"
+#include <unordered_map>
+
+/**
+ * @brief Baseline that keeps the number of copies of each key in a hash table next to a YFastTrie
+ * of the distinct keys.
+ * 
+ * @tparam Key_ is the key type.
+ */
+template <typename Key_>
+class HashTableYFastMultiset {
+public:
+    using key_type = Key_;
+
+private:
+    YFastTrie<key_type, SortedArrayBucket<key_type>> trie_;
+    std::unordered_map<key_type, size_t> counts_;
+
+public:
+    size_t count(key_type key) {
+        auto it = counts_.find(key);
+        return it == counts_.end() ? 0 : it->second;
+    }
+
+    void insert(key_type key) {
+        if (counts_[key]++ == 0) trie_.insert(key);
+    }
+
+    void remove(key_type key) {
+        auto it = counts_.find(key);
+        if (it == counts_.end()) return;
+        if (--it->second == 0) {
+            counts_.erase(it);
+            trie_.remove(key);
+        }
+    }
+};
+
+DEFINE_MULTISET_BENCHMARKS(HashTableYFastMultiset);
+BENCHMARK_MAIN();
\ No newline at end of file
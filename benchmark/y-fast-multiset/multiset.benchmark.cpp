@@ -0,0 +1,16 @@
+/**
+ * @file multiset.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-multiset/y-fast-multiset.h"
+
+template <typename Key_>
+using DefaultYFastMultiset = YFastMultiset<Key_>;
+
+DEFINE_MULTISET_BENCHMARKS(DefaultYFastMultiset);
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,16 @@
+/**
+ * @file map-policy.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-16
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-trie/y-fast-trie.h"
+
+template <typename Key_, template <typename, typename> class Map_>
+using MapYFastTrie = YFastTrie<Key_, RedBlackTree<Key_>, Map_>;
+
+DEFINE_ALL_MAP_POLICY_BENCHMARKS(MapYFastTrie);
+BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,23 @@
+/**
+ * @file simd-sorted-array-bucket.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-16
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-trie/y-fast-trie.h"
+#include "../../src/sorted-array-bucket/sorted-array-bucket.h"
+
+template <typename Key_>
+using SimdSortedArrayYFastTrie = YFastTrie<Key_, SimdSortedArrayBucket<Key_>>;
+
+DEFINE_CONTAINS_BENCHMARKS(SimdSortedArrayYFastTrie);
+DEFINE_PREDECESSOR_BENCHMARKS(SimdSortedArrayYFastTrie);
+DEFINE_SUCCESSOR_BENCHMARKS(SimdSortedArrayYFastTrie);
+DEFINE_MIN_BENCHMARKS(SimdSortedArrayYFastTrie);
+DEFINE_MAX_BENCHMARKS(SimdSortedArrayYFastTrie);
+DEFINE_INSERT_BENCHMARKS(SimdSortedArrayYFastTrie);
+DEFINE_REMOVE_BENCHMARKS(SimdSortedArrayYFastTrie);
+BENCHMARK_MAIN();
\ No newline at end of file
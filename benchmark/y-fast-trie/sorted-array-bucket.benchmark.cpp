@@ -0,0 +1,23 @@
+/**
+ * @file sorted-array-bucket.benchmark.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-16
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-trie/y-fast-trie.h"
+#include "../../src/sorted-array-bucket/sorted-array-bucket.h"
+
+template <typename Key_>
+using SortedArrayYFastTrie = YFastTrie<Key_, SortedArrayBucket<Key_>>;
+
+DEFINE_CONTAINS_BENCHMARKS(SortedArrayYFastTrie);
+DEFINE_PREDECESSOR_BENCHMARKS(SortedArrayYFastTrie);
+DEFINE_SUCCESSOR_BENCHMARKS(SortedArrayYFastTrie);
+DEFINE_MIN_BENCHMARKS(SortedArrayYFastTrie);
+DEFINE_MAX_BENCHMARKS(SortedArrayYFastTrie);
+DEFINE_INSERT_BENCHMARKS(SortedArrayYFastTrie);
+DEFINE_REMOVE_BENCHMARKS(SortedArrayYFastTrie);
+BENCHMARK_MAIN();
\ No newline at end of file
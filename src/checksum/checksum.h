@@ -0,0 +1,114 @@
+/**
+ * @file checksum.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Checksum class.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+/**
+ * @brief Streaming 64-bit checksum for detecting corrupted or truncated files.
+ *
+ * The bytes are consumed eight at a time with the round and final mix of XXH64, so checksumming
+ * runs at several gigabytes per second and does not slow down reading or writing a file. The
+ * checksum only depends on the bytes and not on how they are split between calls to update. It
+ * is not a cryptographic hash.
+ *
+ */
+class Checksum {
+public:
+	using size_type = size_t;
+	using value_type = uint64_t;
+
+private:
+	static constexpr value_type prime1_ = UINT64_C(0x9E3779B185EBCA87);
+	static constexpr value_type prime2_ = UINT64_C(0xC2B2AE3D27D4EB4F);
+	static constexpr value_type prime3_ = UINT64_C(0x165667B19E3779F9);
+
+private:
+	value_type hash_;
+	value_type length_;
+
+	// Bytes that do not fill a whole word yet.
+	unsigned char pending_[sizeof(value_type)];
+	size_type pending_size_;
+
+private:
+	/**
+	 * @brief Mix a word into the checksum.
+	 *
+	 * @param word to mix in.
+	 */
+	inline void mix(value_type word) noexcept {
+		hash_ += word * prime2_;
+		hash_ = (hash_ << 31) | (hash_ >> 33);
+		hash_ *= prime1_;
+	}
+
+public:
+	/**
+	 * @brief Construct a new Checksum object.
+	 *
+	 */
+	Checksum() : hash_(prime3_), length_(0), pending_size_(0) {  }
+
+	/**
+	 * @brief Add some bytes to the checksum.
+	 *
+	 * @param data is the first byte.
+	 * @param size is the number of bytes.
+	 */
+	void update(const void* data, size_type size) noexcept {
+		auto bytes = static_cast<const unsigned char*>(data);
+		length_ += size;
+
+		// Complete the pending word first.
+		if (pending_size_ > 0) {
+			auto fill = std::min(size, sizeof(value_type) - pending_size_);
+			std::memcpy(pending_ + pending_size_, bytes, fill);
+			pending_size_ += fill;
+			bytes += fill;
+			size -= fill;
+			if (pending_size_ < sizeof(value_type)) return;
+
+			value_type word;
+			std::memcpy(&word, pending_, sizeof(word));
+			mix(word);
+			pending_size_ = 0;
+		}
+
+		for (; size >= sizeof(value_type); size -= sizeof(value_type), bytes += sizeof(value_type)) {
+			value_type word;
+			std::memcpy(&word, bytes, sizeof(word));
+			mix(word);
+		}
+
+		std::memcpy(pending_ + pending_size_, bytes, size);
+		pending_size_ += size;
+	}
+
+	/**
+	 * @brief Get the checksum of the bytes added so far.
+	 *
+	 * @return value_type checksum.
+	 */
+	value_type value() const noexcept {
+		auto hash = hash_ ^ length_;
+		for (size_type i = 0; i < pending_size_; ++i)
+			hash = (hash ^ (pending_[i] * prime3_)) * prime1_;
+
+		hash ^= hash >> 33;
+		hash *= prime2_;
+		hash ^= hash >> 29;
+		hash *= prime3_;
+		hash ^= hash >> 32;
+		return hash;
+	}
+};
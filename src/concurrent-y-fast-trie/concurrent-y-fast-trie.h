@@ -0,0 +1,494 @@
+/**
+ * @file concurrent-y-fast-trie.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief ConcurrentYFastTrie class template.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "../y-fast-trie/y-fast-trie.h"
+#include "../sorted-array-bucket/sorted-array-bucket.h"
+#include "epoch-domain.h"
+#include "../constants.h"
+#include <optional>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief YFastTrie that is safe to query and update from many threads at once.
+ *
+ * The index is read without locks. It is kept twice: the trie owns the copy that updates change,
+ * and the other copy is a mirror that readers use between updates. An update that creates, splits,
+ * merges or deletes partitions changes the copy that readers cannot reach, publishes it with an
+ * atomic pointer store, waits for an EpochDomain grace period, and then replays its changes on the
+ * other copy and publishes that one again, so only one copy is ever written and no reader sees it
+ * until it is published. Partitions that the update drops are freed after the first grace period.
+ * Those updates only happen about once every log(M) updates, and they run one at a time.
+ *
+ * The partitions are guarded by a fixed array of stripe locks that are selected by hashing the
+ * partition address. Queries hold the stripes of the partitions they read in shared mode, while
+ * inserts and removes that fit in their partition hold a single stripe exclusively, so updates to
+ * different partitions run in parallel. An update that changes the index holds the stripes of the
+ * partitions it may change until it has published the new index, so an operation that still found
+ * one of them through the old index sees the new index once it has its stripe and starts over.
+ *
+ * Updates to different partitions run at the same time, so buckets must not share mutable state
+ * without synchronizing it. SortedArrayBucket shares nothing. RedBlackTree buckets share a node
+ * allocator and need a thread safe allocator such as SynchronizedNodePool.
+ *
+ * @tparam Key_ is the key type.
+ * @tparam Bucket_ is the bucket type.
+ * @tparam Map_ is the hash table type. See XFastTrie for the requirements.
+ */
+template <typename Key_, typename Bucket_ = SortedArrayBucket<Key_>,
+          template <typename, typename> class Map_ = flat_map>
+class ConcurrentYFastTrie {
+public:
+	using key_type = Key_;
+	using some_key_type = std::optional<key_type>;
+	using size_type = size_t;
+
+private:
+	using trie_type = YFastTrie<key_type, Bucket_, Map_>;
+	using index_type = typename trie_type::index_type;
+	using journal_type = typename trie_type::journal_type;
+	using partition_ptr = typename trie_type::partition_ptr;
+	using node_ptr = typename trie_type::node_ptr;
+	using handle_type = typename trie_type::handle_type;
+	using mutex_type = std::shared_mutex;
+
+	/**
+	 * @brief Neighbor of a partition that a query reads as well.
+	 *
+	 */
+	enum class neighbor_type { none, left, right };
+
+	/**
+	 * @brief Stripe lock on its own cache line, so that neighboring stripes do not contend.
+	 *
+	 */
+	struct alignas(64) stripe_type {
+		mutex_type mutex;
+	};
+
+	/**
+	 * @brief Lock on the stripes of up to three partitions. The stripes are locked in address
+	 * order, so that operations holding several stripes cannot deadlock with each other.
+	 *
+	 * @tparam shared_ is true to lock the stripes in shared mode and false to lock them
+	 * exclusively.
+	 */
+	template <bool shared_>
+	class stripes_lock {
+	private:
+		std::array<mutex_type*, 3> mutexes_;
+
+	public:
+		stripes_lock(mutex_type* first, mutex_type* second, mutex_type* third = nullptr) noexcept(NEX)
+			: mutexes_{first, second, third} {
+			// Missing stripes sort last, and a stripe shared by several partitions is locked once.
+			std::sort(mutexes_.begin(), mutexes_.end(), [](mutex_type* a, mutex_type* b) {
+				return b == nullptr ? a != nullptr : a != nullptr && a < b;
+			});
+			for (size_type i = 1; i < mutexes_.size(); ++i)
+				if (mutexes_[i] == mutexes_[i - 1]) mutexes_[i] = nullptr;
+			for (auto mutex : mutexes_) {
+				if (mutex == nullptr) continue;
+				if (shared_) mutex->lock_shared();
+				else mutex->lock();
+			}
+		}
+
+		stripes_lock(const stripes_lock&) = delete;
+		stripes_lock& operator=(const stripes_lock&) = delete;
+
+		~stripes_lock() {
+			for (auto mutex : mutexes_) {
+				if (mutex == nullptr) continue;
+				if (shared_) mutex->unlock_shared();
+				else mutex->unlock();
+			}
+		}
+	};
+
+private:
+	// Log base 2 of the number of stripe locks.
+	static constexpr size_type stripe_bits_ = 8;
+
+	// Number of stripe locks.
+	static constexpr size_type stripe_count_ = size_type(1) << stripe_bits_;
+
+private:
+	trie_type trie_;
+
+	// Copy of the index of the trie that readers use between updates.
+	index_type mirror_;
+
+	// Index that readers use, which is either the mirror or the index of the trie.
+	std::atomic<const index_type*> index_;
+
+	// Changes that the current update made to the index of the trie.
+	journal_type journal_;
+
+	// Serializes the updates that change the index.
+	std::mutex writer_mutex_;
+
+	mutable std::array<stripe_type, stripe_count_> stripes_;
+
+	// The partitions are updated without the writer lock, so the number of keys is counted here.
+	// The count of the trie is only brought up to date while an update changes the index.
+	std::atomic<size_type> size_;
+
+private:
+	/**
+	 * @brief Get the stripe lock of a partition.
+	 *
+	 * @param partition to get the stripe lock of.
+	 * @return the stripe lock.
+	 */
+	inline mutex_type* get_stripe(partition_ptr partition) const noexcept {
+		// Fibonacci hashing spreads the partitions, which are allocated close together, over
+		// all of the stripes.
+		auto hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(partition));
+		hash = (hash ^ (hash >> 17)) * UINT64_C(0x9E3779B97F4A7C15);
+		return &stripes_[hash >> (64 - stripe_bits_)].mutex;
+	}
+
+	/**
+	 * @brief Get the stripe lock of the partition of a representative node.
+	 *
+	 * @param node is the representative node, which may be nullptr.
+	 * @return the stripe lock or nullptr if the node is nullptr.
+	 */
+	inline mutex_type* get_stripe(node_ptr node) const noexcept {
+		if (node == nullptr) return nullptr;
+		return get_stripe(trie_type::get_partition(node));
+	}
+
+	/**
+	 * @brief Get the index that readers use.
+	 *
+	 * @return the published index.
+	 */
+	inline const index_type* get_index() const noexcept {
+		return index_.load(std::memory_order_seq_cst);
+	}
+
+	/**
+	 * @brief Copy the index of the trie into the empty mirror.
+	 *
+	 */
+	void build_mirror() noexcept(NEX) {
+		std::vector<handle_type> leaves;
+		if (!trie_.index_.empty()) {
+			auto node = trie_.index_.get_leaf_node(trie_.index_.min().value());
+			for (; node != nullptr; node = trie_.index_.get_next_leaf(node))
+				leaves.push_back(mirror_.create_leaf(node->key(), node->payload()));
+		}
+		mirror_.build_levels(leaves);
+	}
+
+	/**
+	 * @brief Run a query on the partition of a key, and on one of its neighbors, with their stripes
+	 * held in shared mode. The partitions are found without locks and the query starts over if
+	 * the index changed before the stripes were locked.
+	 *
+	 * @param key to find the partition of.
+	 * @param neighbor of the partition to lock as well.
+	 * @param query to run with the representative node of the key and of the neighbor, which are
+	 * nullptr if they do not exist.
+	 * @return the result of the query.
+	 */
+	template <typename Query_>
+	auto read_partitions(key_type key, neighbor_type neighbor, Query_ query) const noexcept(NEX) {
+		EpochDomain::read_guard read_guard;
+		while (true) {
+			auto index = get_index();
+			auto node = index->get_inclusive_successor_node(key);
+
+			// The trie was empty when the index was loaded.
+			if (node == nullptr) return query(node, node);
+
+			auto neighbor_node = node_ptr(nullptr);
+			if (neighbor == neighbor_type::left) neighbor_node = index->get_previous_leaf(node);
+			if (neighbor == neighbor_type::right) neighbor_node = index->get_next_leaf(node);
+
+			stripes_lock<true> lock(get_stripe(node), get_stripe(neighbor_node));
+			if (get_index() == index) return query(node, neighbor_node);
+		}
+	}
+
+	/**
+	 * @brief Run an update on the trie that may change the index, and bring the other copy of
+	 * the index up to date.
+	 *
+	 * @param key that the update inserts or removes.
+	 * @param update to run on the trie.
+	 */
+	template <typename Update_>
+	void update_index(key_type key, Update_ update) noexcept(NEX) {
+		std::lock_guard<std::mutex> writer_lock(writer_mutex_);
+		{
+			// The update may change the partition of the key and either of its neighbors. Only
+			// this thread changes the index of the trie, so the partitions cannot move before
+			// their stripes are locked.
+			auto node = trie_.get_representative_node(key);
+			stripes_lock<false> lock(get_stripe(node),
+			                         get_stripe(node ? trie_.get_left_node(node) : nullptr),
+			                         get_stripe(node ? trie_.get_right_node(node) : nullptr));
+
+			trie_.journal_ = &journal_;
+			trie_.size_ = size_.load(std::memory_order_relaxed);
+			auto before = trie_.size_;
+			update();
+			size_.fetch_add(trie_.size_ - before, std::memory_order_relaxed);
+			trie_.journal_ = nullptr;
+
+			// Operations waiting on the stripes see the new index once they have them.
+			index_.store(&trie_.index_, std::memory_order_seq_cst);
+		}
+
+		// Once the readers of the mirror are gone, the dropped partitions are unreachable and the
+		// mirror can be changed.
+		EpochDomain::synchronize();
+		for (auto partition : journal_.retired) delete partition;
+		for (auto& change : journal_.changes) {
+			if (change.second == nullptr) mirror_.remove(change.first);
+			else mirror_.emplace(change.first, change.second);
+		}
+		journal_.changes.clear();
+		journal_.retired.clear();
+
+		// The index of the trie is changed by the next update, so its readers must be gone
+		// before this one returns.
+		index_.store(&mirror_, std::memory_order_seq_cst);
+		EpochDomain::synchronize();
+	}
+
+public:
+	/**
+	 * @brief Get the bit length of the key type.
+	 *
+	 * @return constexpr size_type bit length of the key type.
+	 */
+	static constexpr size_type bit_length() noexcept {
+		return trie_type::bit_length();
+	}
+
+	/**
+	 * @brief Get the maximum key.
+	 *
+	 * @return constexpr key_type maximum key.
+	 */
+	static constexpr key_type upper_bound() noexcept {
+		return trie_type::upper_bound();
+	}
+
+	/**
+	 * @brief Get the minimum key.
+	 *
+	 * @return constexpr key_type minimum key.
+	 */
+	static constexpr key_type lower_bound() noexcept {
+		return trie_type::lower_bound();
+	}
+
+public:
+	/**
+	 * @brief Construct a new ConcurrentYFastTrie object.
+	 *
+	 */
+	ConcurrentYFastTrie() : index_(&mirror_), size_(0) {  }
+
+	/**
+	 * @brief Construct a new ConcurrentYFastTrie object from a sorted range of keys. See the
+	 * range constructor of YFastTrie.
+	 *
+	 * @param first is the beginning of the range.
+	 * @param last is the end of the range.
+	 */
+	template <typename Iterator_>
+	ConcurrentYFastTrie(Iterator_ first, Iterator_ last)
+		: trie_(first, last), index_(&mirror_), size_(trie_.size()) {
+		build_mirror();
+	}
+
+	ConcurrentYFastTrie(const ConcurrentYFastTrie&) = delete;
+	ConcurrentYFastTrie& operator=(const ConcurrentYFastTrie&) = delete;
+
+	/**
+	 * @brief Get the number of keys in the trie. Concurrent updates may not be reflected yet.
+	 *
+	 * @return size_type number of keys in the trie.
+	 */
+	inline size_type size() const noexcept {
+		return size_.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Check if the trie is empty. Concurrent updates may not be reflected yet.
+	 *
+	 * @return true if the trie is empty.
+	 * @return false if the trie is not empty.
+	 */
+	inline bool empty() const noexcept {
+		return size() == 0;
+	}
+
+	/**
+	 * @brief Check if the trie contains a key.
+	 *
+	 * @param key to check if the trie contains.
+	 * @return true if the trie contains the key.
+	 * @return false if the trie does not contain the key.
+	 */
+	bool contains(key_type key) const noexcept(NEX) {
+		return read_partitions(key, neighbor_type::none, [key](node_ptr node, node_ptr) {
+			auto partition = trie_type::get_partition(node);
+			return partition != nullptr && partition->contains(key);
+		});
+	}
+
+	/**
+	 * @brief Find the predecessor of a key.
+	 *
+	 * @param key to find the predecessor of.
+	 * @return some_key_type predecessor key if the predecessor exists.
+	 * @return none_key_type if the predecessor does not exist.
+	 */
+	some_key_type predecessor(key_type key) const noexcept(NEX) {
+		// The predecessor may be in the partition to the left, so both partitions are locked
+		// before either is read.
+		return read_partitions(key, neighbor_type::left, [key](node_ptr node, node_ptr left_node) {
+			auto partition = trie_type::get_partition(node);
+			if (partition == nullptr) return some_key_type();
+			if (partition->min().value() >= key) partition = trie_type::get_partition(left_node);
+			if (partition == nullptr) return some_key_type();
+			return partition->predecessor(key);
+		});
+	}
+
+	/**
+	 * @brief Find the successor of a key.
+	 *
+	 * @param key to find the successor of.
+	 * @return some_key_type successor key if the successor exists.
+	 * @return none_key_type if the successor does not exist.
+	 */
+	some_key_type successor(key_type key) const noexcept(NEX) {
+		// The successor may be in the partition to the right, so both partitions are locked
+		// before either is read.
+		return read_partitions(key, neighbor_type::right, [key](node_ptr node, node_ptr right_node) {
+			auto partition = trie_type::get_partition(node);
+			if (partition == nullptr) return some_key_type();
+			if (partition->max().value() <= key) partition = trie_type::get_partition(right_node);
+			if (partition == nullptr) return some_key_type();
+			return partition->successor(key);
+		});
+	}
+
+	/**
+	 * @brief Find the minimum key.
+	 *
+	 * @return some_key_type minimum key if trie is not empty.
+	 * @return none_key_type if the trie is empty.
+	 */
+	some_key_type min() const noexcept(NEX) {
+		return read_partitions(lower_bound(), neighbor_type::none, [](node_ptr node, node_ptr) {
+			if (node == nullptr) return some_key_type();
+			return trie_type::get_partition(node)->min();
+		});
+	}
+
+	/**
+	 * @brief Find the maximum key.
+	 *
+	 * @return some_key_type maximum key if trie is not empty.
+	 * @return none_key_type if the trie is empty.
+	 */
+	some_key_type max() const noexcept(NEX) {
+		// The default partition holds the maximum, and it exists whenever the trie is not empty.
+		return read_partitions(upper_bound(), neighbor_type::none, [](node_ptr node, node_ptr) {
+			if (node == nullptr) return some_key_type();
+			return trie_type::get_partition(node)->max();
+		});
+	}
+
+	/**
+	 * @brief Insert a key into the trie.
+	 *
+	 * @param key to insert into the trie.
+	 */
+	void insert(key_type key) noexcept(NEX) {
+		{
+			EpochDomain::read_guard read_guard;
+			while (true) {
+				auto index = get_index();
+				auto node = index->get_inclusive_successor_node(key);
+				if (node == nullptr) break;
+				auto partition = trie_type::get_partition(node);
+				std::unique_lock<mutex_type> stripe_lock(*get_stripe(partition));
+				if (get_index() != index) continue;
+
+				// Prevent double inserts.
+				if (partition->contains(key)) return;
+
+				// If the partition does not have to split, then the index is left unchanged.
+				if (partition->size() < trie_type::max_partition_size_) {
+					partition->insert(key);
+					size_.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+				break;
+			}
+		}
+
+		// Otherwise, the key needs a new partition or its partition must split. The trie checks
+		// everything again, since the partitions may have changed while no lock was held.
+		update_index(key, [this, key]() { trie_.insert(key); });
+	}
+
+	/**
+	 * @brief Remove a key from the trie.
+	 *
+	 * @param key to remove from the trie.
+	 */
+	void remove(key_type key) noexcept(NEX) {
+		{
+			EpochDomain::read_guard read_guard;
+			while (true) {
+				auto index = get_index();
+				auto node = index->get_inclusive_successor_node(key);
+				if (node == nullptr) return;
+				auto partition = trie_type::get_partition(node);
+				std::unique_lock<mutex_type> stripe_lock(*get_stripe(partition));
+				if (get_index() != index) continue;
+
+				// Prevent double removes.
+				if (!partition->contains(key)) return;
+
+				// If the partition will neither be deleted nor merged, then the index is left
+				// unchanged.
+				auto remaining = partition->size() - 1;
+				if (remaining >= trie_type::min_partition_size_ ||
+				   (remaining > 0 && index->size() == 1)) {
+					partition->remove(key);
+					size_.fetch_sub(1, std::memory_order_relaxed);
+					return;
+				}
+				break;
+			}
+		}
+
+		// Otherwise, the partition must be deleted or merged. The trie checks everything again,
+		// since the partitions may have changed while no lock was held.
+		update_index(key, [this, key]() { trie_.remove(key); });
+	}
+};
\ No newline at end of file
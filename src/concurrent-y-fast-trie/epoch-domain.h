@@ -0,0 +1,156 @@
+/**
+ * @file epoch-domain.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief EpochDomain class.
+ *
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "../constants.h"
+#include <atomic>
+#include <thread>
+#include <cstdint>
+
+/**
+ * @brief Read-copy-update synchronization for data that is read far more often than it changes.
+ *
+ * Readers wrap their accesses in a read side critical section, which stores the current epoch in
+ * a record owned by the thread and clears it on exit, so readers never wait and never write to a
+ * cache line that another thread writes. A writer changes a copy of the data that no reader can
+ * reach, publishes it with an atomic pointer store, and then calls synchronize, which waits until
+ * every critical section that could still see the old copy has ended. The old copy can then be
+ * reused or freed.
+ *
+ * There is a single domain for the whole process, so each thread needs one record no matter how
+ * many objects it reads. Records are never freed, and a thread that exits leaves its record for
+ * the next thread that starts. Critical sections must not be nested, and a thread must not call
+ * synchronize from inside one.
+ */
+class EpochDomain {
+public:
+	using epoch_type = uint64_t;
+
+private:
+	/**
+	 * @brief Epoch of the critical section of a thread, on its own cache line.
+	 *
+	 */
+	struct alignas(64) record_type {
+		// Epoch at which the current critical section began, or 0 outside of critical sections.
+		std::atomic<epoch_type> epoch{0};
+		std::atomic<bool> in_use{true};
+		record_type* next = nullptr;
+	};
+
+	/**
+	 * @brief Owner of the record of a thread, which releases the record when the thread exits.
+	 *
+	 */
+	class thread_record {
+	public:
+		record_type* record;
+
+		thread_record() noexcept(NEX) : record(acquire_record()) {  }
+
+		~thread_record() {
+			record->in_use.store(false, std::memory_order_release);
+		}
+	};
+
+private:
+	// Records of every thread that has used the domain, pushed at the front.
+	inline static std::atomic<record_type*> records_{nullptr};
+
+	// Current epoch, which synchronize advances. It starts at 1 so that 0 can mark a quiescent
+	// thread.
+	inline static std::atomic<epoch_type> epoch_{1};
+
+private:
+	/**
+	 * @brief Claim a record left by an exited thread or push a new one.
+	 *
+	 * @return the record of the calling thread.
+	 */
+	static record_type* acquire_record() noexcept(NEX) {
+		for (auto record = records_.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+			bool in_use = false;
+			if (!record->in_use.load(std::memory_order_relaxed) &&
+			    record->in_use.compare_exchange_strong(in_use, true, std::memory_order_acq_rel))
+				return record;
+		}
+
+		auto record = new record_type();
+		record->next = records_.load(std::memory_order_relaxed);
+		while (!records_.compare_exchange_weak(record->next, record, std::memory_order_release,
+		                                       std::memory_order_relaxed)) {  }
+		return record;
+	}
+
+	/**
+	 * @brief Get the record of the calling thread.
+	 *
+	 * @return the record.
+	 */
+	static inline record_type& get_record() noexcept(NEX) {
+		static thread_local thread_record owner;
+		return *owner.record;
+	}
+
+public:
+	/**
+	 * @brief Begin a read side critical section. Every object published before it begins, and
+	 * every object that it reads through them, stays alive until it ends.
+	 *
+	 */
+	static inline void enter() noexcept(NEX) {
+		// The record is stored before the reader loads any published pointer, and synchronize
+		// advances the epoch after the writer publishes, so one of them sees the other.
+		get_record().epoch.store(epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+	}
+
+	/**
+	 * @brief End a read side critical section.
+	 *
+	 */
+	static inline void exit() noexcept(NEX) {
+		get_record().epoch.store(0, std::memory_order_release);
+	}
+
+	/**
+	 * @brief Wait until every read side critical section that began before the call has ended.
+	 * Pointers published before the call are then no longer used by any reader that loaded the
+	 * values they replaced.
+	 *
+	 */
+	static void synchronize() noexcept {
+		auto target = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+		for (auto record = records_.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+			while (true) {
+				auto epoch = record->epoch.load(std::memory_order_seq_cst);
+				if (epoch == 0 || epoch >= target) break;
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	/**
+	 * @brief Read side critical section for the lifetime of the object.
+	 *
+	 */
+	class read_guard {
+	public:
+		read_guard() noexcept(NEX) {
+			enter();
+		}
+
+		read_guard(const read_guard&) = delete;
+		read_guard& operator=(const read_guard&) = delete;
+
+		~read_guard() {
+			exit();
+		}
+	};
+};
@@ -0,0 +1,508 @@
+/**
+ * @file frozen-y-fast-trie.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief FrozenYFastTrie class template.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "../sorted-array-bucket/sorted-array-bucket-search.h"
+#include "../checksum/checksum.h"
+#include "../constants.h"
+#include <optional>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <assert.h>
+#include <type_traits>
+
+/**
+ * @brief Read-only Y-Fast Trie that is queried in place from a single contiguous image.
+ *
+ * The image holds no pointers, only offsets from its start, so it can be written to a file,
+ * mapped into memory with MappedFile and queried without being deserialized. Processes that map
+ * the same file share its pages through the page cache. The keys are stored in one sorted array
+ * that is cut into buckets of bit_length() keys, and the maximum key of each bucket is its
+ * representative. Each level of the X-Fast Trie over the representatives is an open addressing
+ * hash table whose slots store a prefix and the indices of the first and last buckets below it,
+ * which stand in for the skip links and the leaf list.
+ *
+ * @tparam Key_ is the key type.
+ * @tparam Search_ is the search policy for the buckets. See sorted-array-bucket-search.h.
+ */
+template <typename Key_, typename Search_ = BranchlessSearch>
+class FrozenYFastTrie {
+public:
+	using key_type = Key_;
+	static_assert(std::is_unsigned<key_type>::value, "Key type must be an unsigned integer.");
+
+	using some_key_type = std::optional<key_type>;
+	using size_type = size_t;
+	using image_type = std::vector<char>;
+
+private:
+	using index_type = uint32_t;
+
+	/**
+	 * @brief Header at the start of the image. Every offset is in bytes from the start of the
+	 * image.
+	 *
+	 */
+	struct header_type {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t key_bits;
+		uint32_t bucket_size;
+		uint64_t size;
+		uint64_t bucket_count;
+		uint64_t keys_offset;
+		uint64_t levels_offset;
+		uint64_t image_size;
+		uint64_t checksum;
+	};
+
+	/**
+	 * @brief Location and size of the hash table of a level.
+	 *
+	 */
+	struct level_type {
+		uint64_t offset;
+		uint64_t capacity;
+		uint64_t shift;
+	};
+
+	/**
+	 * @brief Node of the X-Fast Trie, which is a slot in the hash table of its level. A slot is
+	 * empty if its first bucket is empty_.
+	 *
+	 */
+	struct slot_type {
+		key_type prefix;
+		index_type first;
+		index_type last;
+	};
+
+	static_assert(std::is_trivially_copyable<header_type>::value && std::is_trivially_copyable<level_type>::value &&
+	              std::is_trivially_copyable<slot_type>::value, "The image must be trivially copyable.");
+
+private:
+	// Identifies an image. It also rejects images written with the other byte order.
+	static constexpr uint32_t image_magic_ = UINT32_C(0x5A594659);
+
+	// Version of the image format, which must change whenever the format does.
+	static constexpr uint32_t image_version_ = 2;
+
+	// Marks an empty slot.
+	static constexpr index_type empty_ = std::numeric_limits<index_type>::max();
+
+	// Fibonacci hashing multiplier.
+	static constexpr uint64_t multiplier_ = 0x9E3779B97F4A7C15ull;
+
+	// Alignment of every section of the image.
+	static constexpr size_type alignment_ = 64;
+
+private:
+	const char* image_;
+	const key_type* keys_;
+	const level_type* levels_;
+	size_type size_;
+	size_type bucket_count_;
+
+private:
+	/**
+	 * @brief Round a size up to the alignment of the sections.
+	 *
+	 * @param size to round up.
+	 * @return the rounded size.
+	 */
+	static constexpr size_type align(size_type size) noexcept {
+		return (size + alignment_ - 1) / alignment_ * alignment_;
+	}
+
+	/**
+	 * @brief Check that an array lies inside an image and is aligned like the sections.
+	 *
+	 * @param offset of the array in bytes.
+	 * @param count is the number of elements.
+	 * @param element_size is the size of an element in bytes.
+	 * @param size of the image in bytes.
+	 * @return true if the array lies inside the image.
+	 * @return false if the array does not.
+	 */
+	static constexpr bool fits(uint64_t offset, uint64_t count, size_type element_size, size_type size) noexcept {
+		return offset % alignment_ == 0 && offset <= size && count <= (size - offset) / element_size;
+	}
+
+	/**
+	 * @brief Compute the checksum of an image. The header is covered with its checksum field
+	 * zeroed, so that a damaged size or offset that still passes attach is found by verify.
+	 *
+	 * @param image to checksum, starting with its header.
+	 * @param header of the image.
+	 * @return the checksum.
+	 */
+	static uint64_t image_checksum(const char* image, header_type header) noexcept {
+		header.checksum = 0;
+		Checksum checksum;
+		checksum.update(&header, sizeof(header));
+		checksum.update(image + sizeof(header_type), header.image_size - sizeof(header_type));
+		return checksum.value();
+	}
+
+	/**
+	 * @brief Get the prefix of a key at a level.
+	 *
+	 * @param key to get the prefix of.
+	 * @param level from 1 to bit_length().
+	 * @return the prefix.
+	 */
+	static inline key_type prefix(key_type key, size_type level) noexcept {
+		return static_cast<key_type>(key >> (bit_length() - level));
+	}
+
+	/**
+	 * @brief Get the home slot of a prefix.
+	 *
+	 * @param prefix to hash.
+	 * @param level of the prefix.
+	 * @return index of the home slot.
+	 */
+	static inline size_type home(key_type prefix, const level_type& level) noexcept {
+		return static_cast<size_type>((static_cast<uint64_t>(prefix) * multiplier_) >> level.shift);
+	}
+
+	/**
+	 * @brief Find the node of a prefix.
+	 *
+	 * @param level from 1 to bit_length().
+	 * @param prefix of the node.
+	 * @return the node or nullptr if there is no node with the prefix.
+	 */
+	inline const slot_type* find(size_type level, key_type prefix) const noexcept {
+		auto& table = levels_[level - 1];
+		auto slots = reinterpret_cast<const slot_type*>(image_ + table.offset);
+		auto mask = table.capacity - 1;
+		for (auto index = home(prefix, table); slots[index].first != empty_; index = (index + 1) & mask)
+			if (slots[index].prefix == prefix) return &slots[index];
+		return nullptr;
+	}
+
+	/**
+	 * @brief Find the first bucket whose representative is greater than or equal to a key. The
+	 * trie must not be empty.
+	 *
+	 * @param key to find the bucket of.
+	 * @return the bucket index or the number of buckets if every key is less than the key.
+	 */
+	size_type get_bucket_index(key_type key) const noexcept {
+		// Binary search for the deepest node whose prefix matches the key. The root matches every
+		// key.
+		size_type low = 0;
+		size_type high = bit_length();
+		const slot_type* node = nullptr;
+		while (low < high) {
+			auto mid = (low + high + 1) / 2;
+			auto found = find(mid, prefix(key, mid));
+			if (found != nullptr) {
+				low = mid;
+				node = found;
+			} else {
+				high = mid - 1;
+			}
+		}
+		if (low == bit_length()) return node->first;
+
+		// The child of the node towards the key does not exist, so every bucket below the node is
+		// on the other side of the key.
+		size_type first = node == nullptr ? 0 : node->first;
+		size_type last = node == nullptr ? bucket_count_ - 1 : node->last;
+		bool right = (key >> (bit_length() - low - 1)) & 1;
+		return right ? last + 1 : first;
+	}
+
+	/**
+	 * @brief Count the keys strictly less than a key.
+	 *
+	 * @param key to rank. The trie must not be empty.
+	 * @return the number of keys less than the key.
+	 */
+	inline size_type rank(key_type key) const noexcept {
+		auto bucket = get_bucket_index(key);
+		if (bucket == bucket_count_) return size_;
+		auto first = bucket * bucket_size();
+		auto count = std::min(bucket_size(), size_ - first);
+		return first + Search_::rank(keys_ + first, count, key);
+	}
+
+public:
+	/**
+	 * @brief Get the bit length of the key type.
+	 *
+	 * @return constexpr size_type bit length of the key type.
+	 */
+	static constexpr size_type bit_length() noexcept {
+		return std::numeric_limits<key_type>::digits;
+	}
+
+	/**
+	 * @brief Get the maximum key.
+	 *
+	 * @return constexpr key_type maximum key.
+	 */
+	static constexpr key_type upper_bound() noexcept {
+		return std::numeric_limits<key_type>::max();
+	}
+
+	/**
+	 * @brief Get the minimum key.
+	 *
+	 * @return constexpr key_type minimum key.
+	 */
+	static constexpr key_type lower_bound() noexcept {
+		return std::numeric_limits<key_type>::min();
+	}
+
+	/**
+	 * @brief Get the number of keys in a bucket. Only the last bucket may hold fewer.
+	 *
+	 * @return constexpr size_type number of keys in a bucket.
+	 */
+	static constexpr size_type bucket_size() noexcept {
+		return bit_length();
+	}
+
+	/**
+	 * @brief Build the image of a sorted range of keys in time linear in the number of keys.
+	 *
+	 * @param first key of the range.
+	 * @param last key of the range, exclusive. Duplicate keys are ignored.
+	 * @return image_type image of the keys.
+	 */
+	template <typename Iterator_>
+	static image_type build(Iterator_ first, Iterator_ last) {
+		std::vector<key_type> keys;
+		for (; first != last; ++first) {
+			key_type key = *first;
+			assert((keys.empty() || keys.back() <= key) && "Keys must be sorted.");
+			if (keys.empty() || keys.back() != key) keys.push_back(key);
+		}
+
+		auto size = keys.size();
+		auto bucket_count = (size + bucket_size() - 1) / bucket_size();
+		assert(bucket_count < empty_ && "Too many keys for the image.");
+
+		// Collect the nodes of each level from the representatives, which are in increasing
+		// order, so the representatives below a node are consecutive.
+		std::vector<std::vector<slot_type>> nodes(bit_length());
+		for (size_type level = 1; level <= bit_length(); ++level) {
+			for (size_type bucket = 0; bucket < bucket_count; ++bucket) {
+				auto rep_key = keys[std::min((bucket + 1) * bucket_size(), size) - 1];
+				auto& level_nodes = nodes[level - 1];
+				if (!level_nodes.empty() && level_nodes.back().prefix == prefix(rep_key, level))
+					level_nodes.back().last = static_cast<index_type>(bucket);
+				else
+					level_nodes.push_back(slot_type{prefix(rep_key, level), static_cast<index_type>(bucket),
+					                                static_cast<index_type>(bucket)});
+			}
+		}
+
+		// Lay out the header, the keys, the level descriptors and the hash tables, each on its own
+		// cache line, with every hash table at a load factor of at most 1/2.
+		header_type header = {image_magic_, image_version_, static_cast<uint32_t>(bit_length()),
+		                      static_cast<uint32_t>(bucket_size()), size, bucket_count, 0, 0, 0, 0};
+		header.keys_offset = align(sizeof(header_type));
+		header.levels_offset = align(header.keys_offset + size * sizeof(key_type));
+		std::vector<level_type> levels(bit_length());
+		auto offset = align(header.levels_offset + levels.size() * sizeof(level_type));
+		for (size_type level = 0; level < bit_length(); ++level) {
+			uint64_t capacity = 2;
+			uint64_t shift = 63;
+			while (capacity < 2 * nodes[level].size()) {
+				capacity <<= 1;
+				shift -= 1;
+			}
+			levels[level] = level_type{offset, capacity, shift};
+			offset = align(offset + capacity * sizeof(slot_type));
+		}
+		header.image_size = offset;
+
+		image_type image(offset, 0);
+		if (size > 0) std::memcpy(image.data() + header.keys_offset, keys.data(), size * sizeof(key_type));
+		std::memcpy(image.data() + header.levels_offset, levels.data(), levels.size() * sizeof(level_type));
+		for (size_type level = 0; level < bit_length(); ++level) {
+			auto& table = levels[level];
+			std::vector<slot_type> slots(table.capacity, slot_type{0, empty_, empty_});
+			for (auto& node : nodes[level]) {
+				auto index = home(node.prefix, table);
+				while (slots[index].first != empty_)
+					index = (index + 1) & (table.capacity - 1);
+				slots[index] = node;
+			}
+			std::memcpy(image.data() + table.offset, slots.data(), slots.size() * sizeof(slot_type));
+		}
+
+		header.checksum = image_checksum(image.data(), header);
+		std::memcpy(image.data(), &header, sizeof(header));
+		return image;
+	}
+
+	/**
+	 * @brief Build the image of the keys of an ordered set, such as a YFastTrie.
+	 *
+	 * @param set whose keys to build the image of.
+	 * @return image_type image of the keys.
+	 */
+	template <typename Set_>
+	static image_type build(const Set_& set) {
+		return build(set.begin(), set.end());
+	}
+
+public:
+	/**
+	 * @brief Construct a new empty FrozenYFastTrie object that is not attached to an image.
+	 *
+	 */
+	FrozenYFastTrie() : image_(nullptr), keys_(nullptr), levels_(nullptr), size_(0), bucket_count_(0) {  }
+
+	/**
+	 * @brief Attach to an image in time independent of the number of keys. The image is not
+	 * copied and must outlive the trie. Only the header and the bounds of the sections are
+	 * checked, so an image that may have been corrupted should also be checked with verify.
+	 *
+	 * @param image built by build, aligned to at least 8 bytes.
+	 * @param size of the image in bytes.
+	 * @return true if the trie was attached.
+	 * @return false if the header does not describe an image of this size, in which case the trie
+	 * is left empty.
+	 */
+	bool attach(const void* image, size_type size) noexcept {
+		*this = FrozenYFastTrie();
+		if (size < sizeof(header_type) || reinterpret_cast<uintptr_t>(image) % alignof(uint64_t) != 0) return false;
+
+		header_type header;
+		std::memcpy(&header, image, sizeof(header));
+		if (header.magic != image_magic_ || header.version != image_version_ || header.key_bits != bit_length() ||
+		    header.bucket_size != bucket_size() || header.image_size != size) return false;
+		if (header.bucket_count != (header.size + bucket_size() - 1) / bucket_size()) return false;
+		if (!fits(header.keys_offset, header.size, sizeof(key_type), size)) return false;
+		if (!fits(header.levels_offset, bit_length(), sizeof(level_type), size)) return false;
+
+		// Check that every hash table lies inside the image, so that no query reads past it.
+		auto levels = reinterpret_cast<const level_type*>(static_cast<const char*>(image) + header.levels_offset);
+		for (size_type level = 0; level < bit_length(); ++level) {
+			auto& table = levels[level];
+			if (table.shift == 0 || table.shift > 63 || (uint64_t(1) << (64 - table.shift)) != table.capacity) return false;
+			if (!fits(table.offset, table.capacity, sizeof(slot_type), size)) return false;
+		}
+
+		image_ = static_cast<const char*>(image);
+		keys_ = reinterpret_cast<const key_type*>(image_ + header.keys_offset);
+		levels_ = levels;
+		size_ = header.size;
+		bucket_count_ = header.bucket_count;
+		return true;
+	}
+
+	/**
+	 * @brief Check the checksum of the attached image in time linear in its size.
+	 *
+	 * @return true if the image matches its checksum or no image is attached.
+	 * @return false if the image is corrupt.
+	 */
+	bool verify() const noexcept {
+		if (image_ == nullptr) return true;
+		header_type header;
+		std::memcpy(&header, image_, sizeof(header));
+		return image_checksum(image_, header) == header.checksum;
+	}
+
+	/**
+	 * @brief Get the number of keys stored in the trie.
+	 *
+	 * @return size_type number of keys stored in the trie.
+	 */
+	inline size_type size() const noexcept {
+		return size_;
+	}
+
+	/**
+	 * @brief Check if the trie is empty.
+	 *
+	 * @return true if the trie contains no keys.
+	 * @return false if the trie contains some keys.
+	 */
+	inline bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	/**
+	 * @brief Check if the trie contains a key.
+	 *
+	 * @param key to check if the trie contains.
+	 * @return true if the trie contains the key.
+	 * @return false if the trie does not contain the key.
+	 */
+	bool contains(key_type key) const noexcept {
+		if (empty()) return false;
+		auto index = rank(key);
+		return index < size_ && keys_[index] == key;
+	}
+
+	/**
+	 * @brief Find the predecessor of a key.
+	 *
+	 * @param key to find the predecessor of.
+	 * @return some_key_type predecessor key if the predecessor exists.
+	 * @return none_key_type if the predecessor does not exist.
+	 */
+	some_key_type predecessor(key_type key) const noexcept {
+		if (empty()) return some_key_type();
+		auto index = rank(key);
+		if (index == 0) return some_key_type();
+		return some_key_type(keys_[index - 1]);
+	}
+
+	/**
+	 * @brief Find the successor of a key.
+	 *
+	 * @param key to find the successor of.
+	 * @return some_key_type successor key if the successor exists.
+	 * @return none_key_type if the successor does not exist.
+	 */
+	some_key_type successor(key_type key) const noexcept {
+		if (empty()) return some_key_type();
+
+		// The buckets are consecutive in the key array, so the successor may be the first key of
+		// the next bucket without another search.
+		auto index = rank(key);
+		index += (index < size_ && keys_[index] == key);
+		if (index == size_) return some_key_type();
+		return some_key_type(keys_[index]);
+	}
+
+	/**
+	 * @brief Find the minimum key.
+	 *
+	 * @return some_key_type minimum key if trie is not empty.
+	 * @return none_key_type if the trie is empty.
+	 */
+	some_key_type min() const noexcept {
+		if (empty()) return some_key_type();
+		return some_key_type(keys_[0]);
+	}
+
+	/**
+	 * @brief Find the maximum key.
+	 *
+	 * @return some_key_type maximum key if trie is not empty.
+	 * @return none_key_type if the trie is empty.
+	 */
+	some_key_type max() const noexcept {
+		if (empty()) return some_key_type();
+		return some_key_type(keys_[size_ - 1]);
+	}
+};
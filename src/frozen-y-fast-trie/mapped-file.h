@@ -0,0 +1,107 @@
+/**
+ * @file mapped-file.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief MappedFile class.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Read-only memory mapping of a whole file, such as the image of a FrozenYFastTrie.
+ *
+ * The file is mapped shared, so every process that maps it reads the same pages from the page
+ * cache, and pages are only read from disk when they are first touched. Mapping takes the same
+ * time no matter how large the file is. Requires a POSIX system.
+ *
+ */
+class MappedFile {
+public:
+	using size_type = size_t;
+
+private:
+	void* data_;
+	size_type size_;
+
+public:
+	/**
+	 * @brief Construct a new MappedFile object that does not map any file.
+	 *
+	 */
+	MappedFile() : data_(nullptr), size_(0) {  }
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/**
+	 * @brief Map a file, unmapping the current file first.
+	 *
+	 * @param path of the file.
+	 * @return true if the file was mapped.
+	 * @return false if the file could not be opened or mapped, or is empty.
+	 */
+	bool open(const char* path) noexcept {
+		close();
+		int fd = ::open(path, O_RDONLY);
+		if (fd < 0) return false;
+
+		struct stat status;
+		if (::fstat(fd, &status) != 0 || status.st_size <= 0) {
+			::close(fd);
+			return false;
+		}
+
+		// The mapping keeps the file alive, so the descriptor is not needed afterwards.
+		auto size = static_cast<size_type>(status.st_size);
+		void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (data == MAP_FAILED) return false;
+
+		data_ = data;
+		size_ = size;
+		return true;
+	}
+
+	/**
+	 * @brief Unmap the file. Nothing happens if no file is mapped.
+	 *
+	 */
+	void close() noexcept {
+		if (data_ != nullptr) ::munmap(data_, size_);
+		data_ = nullptr;
+		size_ = 0;
+	}
+
+	/**
+	 * @brief Get the first byte of the file, which is aligned to a page.
+	 *
+	 * @return const void* first byte or nullptr if no file is mapped.
+	 */
+	inline const void* data() const noexcept {
+		return data_;
+	}
+
+	/**
+	 * @brief Get the size of the file.
+	 *
+	 * @return size_type size of the file in bytes.
+	 */
+	inline size_type size() const noexcept {
+		return size_;
+	}
+
+	/**
+	 * @brief Destroy the MappedFile object and unmap the file.
+	 *
+	 */
+	~MappedFile() {
+		close();
+	}
+};
@@ -0,0 +1,44 @@
+/**
+ * @file memory-breakdown.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief MemoryBreakdown class.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include <cstddef>
+
+/**
+ * @brief Heap memory of a data structure in bytes, split by what the memory is spent on. The
+ * memory of the object itself is not included.
+ *
+ */
+class MemoryBreakdown {
+public:
+	using size_type = size_t;
+
+public:
+	// Bytes of the live nodes of the trees.
+	size_type nodes = 0;
+
+	// Bytes of the hash tables and other arrays, including their unused slots.
+	size_type tables = 0;
+
+	// Bytes of the partitions, including the keys stored in them.
+	size_type partitions = 0;
+
+	// Bytes allocated for nodes that are free or not handed out yet.
+	size_type slack = 0;
+
+public:
+	/**
+	 * @brief Get the total number of bytes.
+	 *
+	 * @return size_type total number of bytes.
+	 */
+	inline size_type total() const noexcept {
+		return nodes + tables + partitions + slack;
+	}
+};
@@ -0,0 +1,248 @@
+/**
+ * @file node-arena.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief NodeArena class template.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "../constants.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <assert.h>
+#include <type_traits>
+
+/**
+ * @brief Largest handle that a node type can store. Nodes that pack flags next to their links
+ * declare a smaller max_handle, and the arena must not hand out handles beyond it.
+ *
+ * @tparam Node_ is the node type.
+ */
+template <typename Node_, typename = void>
+struct node_handle_limit : std::integral_constant<uint64_t, std::numeric_limits<uint32_t>::max()> {  };
+
+template <typename Node_>
+struct node_handle_limit<Node_, std::void_t<decltype(Node_::max_handle)>>
+	: std::integral_constant<uint64_t, (static_cast<uint64_t>(Node_::max_handle) <
+	                                    std::numeric_limits<uint32_t>::max()) ?
+	                                   static_cast<uint64_t>(Node_::max_handle) :
+	                                   std::numeric_limits<uint32_t>::max()> {  };
+
+/**
+ * @brief Slab allocator for fixed size nodes that are referred to by 32-bit handles instead of
+ * pointers.
+ *
+ * A handle is one more than the index of a slot, so 0 is never a valid handle and can stand for
+ * no node. The slabs double in size, so the slab and the offset of a slot follow from the
+ * position of the highest set bit of its index, and resolving a handle costs a shift and one load
+ * from a fixed table of slabs. Slabs are never moved or released while the arena is alive, so a
+ * resolved pointer stays valid until its node is destroyed. Freed slots are recycled through an
+ * intrusive free list of handles. Like NodePool, the node type must be trivially destructible.
+ * The arena hands out at most node_handle_limit<Node_> handles, and creating a node beyond that
+ * throws std::length_error.
+ *
+ * @tparam Node_ is the node type.
+ */
+template <typename Node_>
+class NodeArena {
+public:
+	using node_type = Node_;
+	using node_ptr = node_type*;
+	using handle_type = uint32_t;
+	using size_type = size_t;
+	static_assert(std::is_trivially_destructible<node_type>::value,
+	              "Node type must be trivially destructible.");
+
+	// The handle that does not refer to any node.
+	static constexpr handle_type null_handle = 0;
+
+private:
+	/**
+	 * @brief Storage for a single node. Free slots store the handle of the next free slot instead.
+	 *
+	 */
+	union slot_type {
+		handle_type next;
+		alignas(node_type) unsigned char storage[sizeof(node_type)];
+	};
+
+	using slot_ptr = slot_type*;
+
+private:
+	// Base 2 logarithm of the number of slots in the first slab.
+	static constexpr size_type initial_slab_shift_ = 6;
+
+	// Number of slots in the first slab.
+	static constexpr size_type initial_slab_size_ = static_cast<size_type>(1) << initial_slab_shift_;
+
+	// Number of slots that can be handed out, leaving 0 for the null handle.
+	static constexpr size_type max_size_ = node_handle_limit<node_type>::value;
+
+	// Number of slabs needed for every handle, which is one more than the slab of the last handle.
+	static constexpr size_type max_slab_count_ =
+		64 - __builtin_clzll(max_size_ - 1 + initial_slab_size_) - initial_slab_shift_;
+
+	using slabs_type = std::array<slot_ptr, max_slab_count_>;
+
+private:
+	slabs_type slabs_;
+	size_type slab_count_;
+	handle_type free_list_;
+	size_type next_index_;
+	size_type capacity_;
+	size_type size_;
+
+private:
+	/**
+	 * @brief Get the slot of a handle.
+	 *
+	 * @param handle of the slot, which is not the null handle.
+	 * @return the slot.
+	 */
+	inline slot_ptr slot(handle_type handle) const noexcept {
+		assert(handle != null_handle && handle <= next_index_);
+		auto position = static_cast<uint64_t>(handle) - 1 + initial_slab_size_;
+		auto slab = (63 - __builtin_clzll(position)) - initial_slab_shift_;
+		return slabs_[slab] + (position - (initial_slab_size_ << slab));
+	}
+
+	/**
+	 * @brief Allocate the next slab, which is twice the size of the previous slab.
+	 *
+	 */
+	void grow() noexcept(NEX) {
+		assert(slab_count_ < max_slab_count_ && "The arena is out of handles.");
+		auto slab_size = initial_slab_size_ << slab_count_;
+		slabs_[slab_count_] = new slot_type[slab_size];
+		slab_count_ += 1;
+		capacity_ += slab_size;
+	}
+
+	/**
+	 * @brief Get an unused slot, preferring recycled slots.
+	 *
+	 * @return the handle of the slot.
+	 */
+	inline handle_type acquire() noexcept(NEX) {
+		if (free_list_ != null_handle) {
+			auto handle = free_list_;
+			free_list_ = slot(handle)->next;
+			return handle;
+		}
+		if (next_index_ == max_size_) {
+			if constexpr (NEX) std::abort();
+			else throw std::length_error("The arena is out of handles.");
+		}
+		if (next_index_ == capacity_)
+			grow();
+		next_index_ += 1;
+		return static_cast<handle_type>(next_index_);
+	}
+
+public:
+	/**
+	 * @brief Construct a new NodeArena object. No memory is allocated until the first node is
+	 * created.
+	 *
+	 */
+	NodeArena()
+		: slabs_(), slab_count_(0), free_list_(null_handle), next_index_(0), capacity_(0), size_(0) {  }
+
+	NodeArena(const NodeArena&) = delete;
+	NodeArena& operator=(const NodeArena&) = delete;
+
+	/**
+	 * @brief Get the largest number of nodes that can be live at once.
+	 *
+	 * @return number of handles the arena can hand out.
+	 */
+	static constexpr size_type max_size() noexcept {
+		return max_size_;
+	}
+
+	/**
+	 * @brief Get the number of live nodes.
+	 *
+	 * @return number of live nodes.
+	 */
+	inline size_type size() const noexcept {
+		return size_;
+	}
+
+	/**
+	 * @brief Get the number of bytes allocated for slabs, whether their slots are in use or not.
+	 *
+	 * @return number of bytes allocated by the arena.
+	 */
+	inline size_type memory_usage() const noexcept {
+		return capacity_ * sizeof(slot_type);
+	}
+
+	/**
+	 * @brief Construct a node in the arena.
+	 *
+	 * @param args to forward to the node constructor.
+	 * @return the handle of the new node.
+	 */
+	template <typename... Args>
+	inline handle_type create(Args&&... args) noexcept(NEX) {
+		auto handle = acquire();
+		new (slot(handle)->storage) node_type(std::forward<Args>(args)...);
+		size_ += 1;
+		return handle;
+	}
+
+	/**
+	 * @brief Get the node of a handle.
+	 *
+	 * @param handle of a live node.
+	 * @return pointer to the node.
+	 */
+	inline node_ptr at(handle_type handle) const noexcept {
+		return std::launder(reinterpret_cast<node_ptr>(slot(handle)->storage));
+	}
+
+	/**
+	 * @brief Destroy a node created by this arena and recycle its slot.
+	 *
+	 * @param handle of the node to destroy.
+	 */
+	inline void destroy(handle_type handle) noexcept(NEX) {
+		assert(handle != null_handle && size_ > 0);
+		at(handle)->~node_type();
+		slot(handle)->next = free_list_;
+		free_list_ = handle;
+		size_ -= 1;
+	}
+
+	/**
+	 * @brief Release every slab. Handles created by the arena must not be used afterwards.
+	 *
+	 */
+	void clear() noexcept {
+		for (size_type i = 0; i < slab_count_; ++i)
+			delete[] slabs_[i];
+		slabs_.fill(nullptr);
+		slab_count_ = 0;
+		free_list_ = null_handle;
+		next_index_ = 0;
+		capacity_ = 0;
+		size_ = 0;
+	}
+
+	/**
+	 * @brief Destroy the NodeArena object and release every slab.
+	 *
+	 */
+	~NodeArena() {
+		clear();
+	}
+};
@@ -0,0 +1,260 @@
+/**
+ * @file node-pool.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief NodePool class template.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ */
+
+#pragma once
+#include "../constants.h"
+#include <cstddef>
+#include <new>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <assert.h>
+#include <type_traits>
+
+/**
+ * @brief Slab allocator for fixed size nodes.
+ *
+ * Nodes are carved out of contiguous slabs that double in size up to a fixed limit, and freed
+ * nodes are recycled through an intrusive free list, so creating and destroying a node never
+ * calls the global allocator once the pool has warmed up. Destroying the pool releases every
+ * slab at once without running the destructors of the nodes that are still alive, so the node
+ * type must be trivially destructible.
+ *
+ * @tparam Node_ is the node type.
+ */
+template <typename Node_>
+class NodePool {
+public:
+	using node_type = Node_;
+	using node_ptr = node_type*;
+	using size_type = size_t;
+	static_assert(std::is_trivially_destructible<node_type>::value,
+	              "Node type must be trivially destructible.");
+
+private:
+	/**
+	 * @brief Storage for a single node. Free slots store the next free slot instead.
+	 *
+	 */
+	union slot_type {
+		slot_type* next;
+		alignas(node_type) unsigned char storage[sizeof(node_type)];
+	};
+
+	using slot_ptr = slot_type*;
+	using slabs_type = std::vector<slot_ptr>;
+
+private:
+	// Number of slots in the first slab.
+	static constexpr size_type initial_slab_size_ = 64;
+
+	// Number of slots in the largest slab.
+	static constexpr size_type max_slab_size_ = 4096;
+
+private:
+	slabs_type slabs_;
+	slot_ptr free_list_;
+	slot_ptr next_slot_;
+	slot_ptr slab_end_;
+	size_type next_slab_size_;
+	size_type capacity_;
+	size_type size_;
+
+private:
+	/**
+	 * @brief Allocate a new slab and make it the current slab.
+	 *
+	 */
+	void grow() noexcept(NEX) {
+		auto slab = new slot_type[next_slab_size_];
+		slabs_.push_back(slab);
+		next_slot_ = slab;
+		slab_end_ = slab + next_slab_size_;
+		capacity_ += next_slab_size_;
+		if (next_slab_size_ < max_slab_size_)
+			next_slab_size_ <<= 1;
+	}
+
+	/**
+	 * @brief Get an unused slot, preferring recycled slots.
+	 *
+	 * @return the slot.
+	 */
+	inline slot_ptr acquire() noexcept(NEX) {
+		if (free_list_ != nullptr) {
+			auto slot = free_list_;
+			free_list_ = slot->next;
+			return slot;
+		}
+		if (next_slot_ == slab_end_)
+			grow();
+		return next_slot_++;
+	}
+
+public:
+	/**
+	 * @brief Construct a new NodePool object. No memory is allocated until the first node is
+	 * created.
+	 *
+	 */
+	NodePool()
+		: free_list_(nullptr), next_slot_(nullptr), slab_end_(nullptr),
+		  next_slab_size_(initial_slab_size_), capacity_(0), size_(0) {  }
+
+	NodePool(const NodePool&) = delete;
+	NodePool& operator=(const NodePool&) = delete;
+
+	/**
+	 * @brief Get the number of live nodes.
+	 *
+	 * @return number of live nodes.
+	 */
+	inline size_type size() const noexcept {
+		return size_;
+	}
+
+	/**
+	 * @brief Get the number of bytes allocated for slabs, whether their slots are in use or not.
+	 *
+	 * @return number of bytes allocated by the pool.
+	 */
+	inline size_type memory_usage() const noexcept {
+		return capacity_ * sizeof(slot_type) + slabs_.capacity() * sizeof(slot_ptr);
+	}
+
+	/**
+	 * @brief Construct a node in the pool.
+	 *
+	 * @param args to forward to the node constructor.
+	 * @return pointer to the new node.
+	 */
+	template <typename... Args>
+	inline node_ptr create(Args&&... args) noexcept(NEX) {
+		auto slot = acquire();
+		size_ += 1;
+		return new (slot->storage) node_type(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief Destroy a node created by this pool and recycle its storage.
+	 *
+	 * @param node to destroy.
+	 */
+	inline void destroy(node_ptr node) noexcept(NEX) {
+		assert(node != nullptr && size_ > 0);
+		node->~node_type();
+		auto slot = reinterpret_cast<slot_ptr>(node);
+		slot->next = free_list_;
+		free_list_ = slot;
+		size_ -= 1;
+	}
+
+	/**
+	 * @brief Release every slab. Nodes created by the pool must not be used afterwards.
+	 *
+	 */
+	void clear() noexcept {
+		for (auto slab : slabs_)
+			delete[] slab;
+		slabs_type().swap(slabs_);
+		free_list_ = nullptr;
+		next_slot_ = nullptr;
+		slab_end_ = nullptr;
+		next_slab_size_ = initial_slab_size_;
+		capacity_ = 0;
+		size_ = 0;
+	}
+
+	/**
+	 * @brief Destroy the NodePool object and release every slab.
+	 *
+	 */
+	~NodePool() {
+		clear();
+	}
+};
+
+/**
+ * @brief NodePool that serializes creating and destroying nodes, so that trees sharing the pool
+ * can be updated from different threads.
+ *
+ * @tparam Node_ is the node type.
+ */
+template <typename Node_>
+class SynchronizedNodePool {
+public:
+	using node_type = Node_;
+	using node_ptr = node_type*;
+	using size_type = size_t;
+
+private:
+	NodePool<node_type> pool_;
+	mutable std::mutex mutex_;
+
+public:
+	/**
+	 * @brief Construct a new SynchronizedNodePool object.
+	 *
+	 */
+	SynchronizedNodePool() = default;
+
+	SynchronizedNodePool(const SynchronizedNodePool&) = delete;
+	SynchronizedNodePool& operator=(const SynchronizedNodePool&) = delete;
+
+	/**
+	 * @brief Get the number of live nodes.
+	 *
+	 * @return number of live nodes.
+	 */
+	size_type size() const noexcept(NEX) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return pool_.size();
+	}
+
+	/**
+	 * @brief Get the number of bytes allocated for slabs, whether their slots are in use or not.
+	 *
+	 * @return number of bytes allocated by the pool.
+	 */
+	size_type memory_usage() const noexcept(NEX) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return pool_.memory_usage();
+	}
+
+	/**
+	 * @brief Construct a node in the pool.
+	 *
+	 * @param args to forward to the node constructor.
+	 * @return pointer to the new node.
+	 */
+	template <typename... Args>
+	node_ptr create(Args&&... args) noexcept(NEX) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return pool_.create(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief Destroy a node created by this pool and recycle its storage.
+	 *
+	 * @param node to destroy.
+	 */
+	void destroy(node_ptr node) noexcept(NEX) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		pool_.destroy(node);
+	}
+
+	/**
+	 * @brief Release every slab. Nodes created by the pool must not be used afterwards.
+	 *
+	 */
+	void clear() noexcept(NEX) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		pool_.clear();
+	}
+};
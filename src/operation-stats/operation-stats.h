@@ -0,0 +1,114 @@
+/**
+ * @file operation-stats.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief OperationCounters class and the NoStats and OperationStats instrumentation policies.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Snapshot of the work done by the operations on a data structure since it was created or
+ * its counters were last reset.
+ *
+ */
+class OperationCounters {
+public:
+	using counter_type = uint64_t;
+
+public:
+	// Hash table lookups made while searching for the longest matching prefix of a key.
+	counter_type hash_probes = 0;
+
+	// Iterations of the binary search over the levels of an x-fast trie.
+	counter_type search_steps = 0;
+
+	// Partitions split because they grew too large.
+	counter_type splits = 0;
+
+	// Pairs of partitions merged because one of them shrank too small.
+	counter_type merges = 0;
+
+	// Nodes created by the allocators.
+	counter_type nodes_allocated = 0;
+
+	// Nodes destroyed by the allocators.
+	counter_type nodes_freed = 0;
+
+	// Red-black tree rotations.
+	counter_type rotations = 0;
+};
+
+/**
+ * @brief Instrumentation policy that counts nothing. Every hook is an empty inline function and
+ * the policy is an empty base class, so an uninstrumented data structure has the same code and
+ * the same size as it would without the hooks.
+ *
+ */
+class NoStats {
+public:
+	// Hooks called by the data structures, one for each counter.
+	inline void count_hash_probe() const noexcept {  }
+	inline void count_search_step() const noexcept {  }
+	inline void count_split() const noexcept {  }
+	inline void count_merge() const noexcept {  }
+	inline void count_node_allocation() const noexcept {  }
+	inline void count_node_free() const noexcept {  }
+	inline void count_rotation() const noexcept {  }
+
+	/**
+	 * @brief Get the counters, which are always 0.
+	 *
+	 * @return OperationCounters with every counter 0.
+	 */
+	inline OperationCounters snapshot() const noexcept {
+		return OperationCounters();
+	}
+
+	/**
+	 * @brief Reset the counters, which does nothing.
+	 *
+	 */
+	inline void reset() const noexcept {  }
+};
+
+/**
+ * @brief Instrumentation policy that counts the work done by the operations. The hooks are called
+ * from const queries as well, so the counters are mutable. They are plain integers, so an
+ * instrumented data structure must not be queried from several threads at once.
+ *
+ */
+class OperationStats {
+private:
+	mutable OperationCounters counters_;
+
+public:
+	// Hooks called by the data structures, one for each counter.
+	inline void count_hash_probe() const noexcept { counters_.hash_probes += 1; }
+	inline void count_search_step() const noexcept { counters_.search_steps += 1; }
+	inline void count_split() const noexcept { counters_.splits += 1; }
+	inline void count_merge() const noexcept { counters_.merges += 1; }
+	inline void count_node_allocation() const noexcept { counters_.nodes_allocated += 1; }
+	inline void count_node_free() const noexcept { counters_.nodes_freed += 1; }
+	inline void count_rotation() const noexcept { counters_.rotations += 1; }
+
+	/**
+	 * @brief Get a copy of the counters.
+	 *
+	 * @return OperationCounters counted so far.
+	 */
+	inline OperationCounters snapshot() const noexcept {
+		return counters_;
+	}
+
+	/**
+	 * @brief Set every counter to 0.
+	 *
+	 */
+	inline void reset() const noexcept {
+		counters_ = OperationCounters();
+	}
+};
@@ -0,0 +1,357 @@
+/**
+ * @file rank-tree.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief RankTree class template.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "../node-pool/node-arena.h"
+#include "../constants.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <assert.h>
+#include <type_traits>
+
+/**
+ * @brief AVL tree of distinct keys that each carry a value and a weight. Every node also stores
+ * the total weight of its subtree, so inserting, removing or reweighting a key, summing the
+ * weights of the keys less than a key and finding the key at a weighted position all walk a
+ * single path and take time logarithmic in the number of keys. The nodes are allocated from a
+ * NodeArena and linked by handles.
+ *
+ * @tparam Key_ is the key type.
+ * @tparam Value_ is the value type, which must be trivially destructible.
+ */
+template <typename Key_, typename Value_>
+class RankTree {
+public:
+	using key_type = Key_;
+	using value_type = Value_;
+	using weight_type = uint64_t;
+	using size_type = size_t;
+	static_assert(std::is_trivially_destructible<value_type>::value,
+	              "Value type must be trivially destructible.");
+
+	/**
+	 * @brief A key with its value and weight, used to build a tree from sorted keys.
+	 *
+	 */
+	class entry_type {
+	public:
+		key_type key;
+		value_type value;
+		weight_type weight;
+	};
+
+private:
+	/**
+	 * @brief Node of the tree, which links to its children by handle.
+	 *
+	 */
+	class Node {
+	public:
+		key_type key;
+		value_type value;
+		weight_type weight;
+		weight_type total;
+		uint32_t children[2];
+		int height;
+	};
+
+	using arena_type = NodeArena<Node>;
+	using handle_type = typename arena_type::handle_type;
+
+	// The handle of a missing child.
+	static constexpr handle_type null_ = arena_type::null_handle;
+
+private:
+	arena_type arena_;
+	handle_type root_;
+	size_type size_;
+
+private:
+	inline Node* at(handle_type handle) const noexcept {
+		return arena_.at(handle);
+	}
+
+	inline int height(handle_type handle) const noexcept {
+		return handle == null_ ? 0 : at(handle)->height;
+	}
+
+	inline weight_type total(handle_type handle) const noexcept {
+		return handle == null_ ? 0 : at(handle)->total;
+	}
+
+	/**
+	 * @brief Create a node without children.
+	 *
+	 * @param entry to store in the node.
+	 * @return the handle of the node.
+	 */
+	inline handle_type create_node(const entry_type& entry) noexcept(NEX) {
+		size_ += 1;
+		return arena_.create(Node{entry.key, entry.value, entry.weight, entry.weight, {null_, null_}, 1});
+	}
+
+	/**
+	 * @brief Recompute the height and total weight of a node from its children.
+	 *
+	 * @param handle of the node.
+	 */
+	inline void update(handle_type handle) noexcept {
+		auto node = at(handle);
+		node->height = 1 + std::max(height(node->children[0]), height(node->children[1]));
+		node->total = node->weight + total(node->children[0]) + total(node->children[1]);
+	}
+
+	/**
+	 * @brief Rotate a child of a node above the node.
+	 *
+	 * @param handle of the node.
+	 * @param side of the child, where 0 is the left child and 1 is the right child.
+	 * @return the handle of the child, which is the new root of the subtree.
+	 */
+	handle_type rotate(handle_type handle, int side) noexcept {
+		auto node = at(handle);
+		auto child_handle = node->children[side];
+		auto child = at(child_handle);
+		node->children[side] = child->children[!side];
+		child->children[!side] = handle;
+		update(handle);
+		update(child_handle);
+		return child_handle;
+	}
+
+	/**
+	 * @brief Restore the balance of a node whose subtrees differ in height by at most 2.
+	 *
+	 * @param handle of the node.
+	 * @return the handle of the new root of the subtree.
+	 */
+	handle_type balance(handle_type handle) noexcept {
+		update(handle);
+		auto node = at(handle);
+		auto difference = height(node->children[0]) - height(node->children[1]);
+		if (difference >= -1 && difference <= 1) return handle;
+
+		// A taller child that leans away from its parent is rotated first, so that a single
+		// rotation of the parent balances the subtree.
+		int side = difference > 0 ? 0 : 1;
+		auto child = at(node->children[side]);
+		if (height(child->children[!side]) > height(child->children[side]))
+			node->children[side] = rotate(node->children[side], !side);
+		return rotate(handle, side);
+	}
+
+	handle_type insert(handle_type handle, const entry_type& entry) noexcept(NEX) {
+		if (handle == null_) return create_node(entry);
+		auto node = at(handle);
+		assert(node->key != entry.key && "Key is already in the tree.");
+		int side = node->key < entry.key;
+		auto child = insert(node->children[side], entry);
+		node->children[side] = child;
+		return balance(handle);
+	}
+
+	/**
+	 * @brief Unlink the node with the minimum key of a subtree.
+	 *
+	 * @param handle of the root of the subtree.
+	 * @param min_handle receives the handle of the unlinked node.
+	 * @return the handle of the new root of the subtree.
+	 */
+	handle_type unlink_min(handle_type handle, handle_type& min_handle) noexcept {
+		auto node = at(handle);
+		if (node->children[0] == null_) {
+			min_handle = handle;
+			return node->children[1];
+		}
+		node->children[0] = unlink_min(node->children[0], min_handle);
+		return balance(handle);
+	}
+
+	handle_type remove(handle_type handle, key_type key) noexcept(NEX) {
+		assert(handle != null_ && "Key is not in the tree.");
+		auto node = at(handle);
+		if (node->key != key) {
+			int side = node->key < key;
+			node->children[side] = remove(node->children[side], key);
+			return balance(handle);
+		}
+
+		// A node with at most one child is replaced by that child, and otherwise by the minimum
+		// of its right subtree.
+		handle_type replacement;
+		if (node->children[0] == null_ || node->children[1] == null_) {
+			replacement = node->children[node->children[0] == null_];
+		}
+		else {
+			auto right = unlink_min(node->children[1], replacement);
+			at(replacement)->children[0] = node->children[0];
+			at(replacement)->children[1] = right;
+			replacement = balance(replacement);
+		}
+		arena_.destroy(handle);
+		size_ -= 1;
+		return replacement;
+	}
+
+	handle_type build(const std::vector<entry_type>& entries, size_type first, size_type last) noexcept(NEX) {
+		if (first == last) return null_;
+		auto middle = first + (last - first) / 2;
+		auto handle = create_node(entries[middle]);
+		auto left = build(entries, first, middle);
+		auto right = build(entries, middle + 1, last);
+		at(handle)->children[0] = left;
+		at(handle)->children[1] = right;
+		update(handle);
+		return handle;
+	}
+
+public:
+	/**
+	 * @brief Construct a new empty RankTree object.
+	 *
+	 */
+	RankTree() : root_(null_), size_(0) {  }
+
+	RankTree(const RankTree&) = delete;
+	RankTree& operator=(const RankTree&) = delete;
+
+	/**
+	 * @brief Get the number of keys in the tree.
+	 *
+	 * @return number of keys.
+	 */
+	inline size_type size() const noexcept {
+		return size_;
+	}
+
+	/**
+	 * @brief Get the total weight of the keys in the tree.
+	 *
+	 * @return total weight.
+	 */
+	inline weight_type total_weight() const noexcept {
+		return total(root_);
+	}
+
+	/**
+	 * @brief Get the number of bytes allocated for nodes.
+	 *
+	 * @return number of bytes allocated by the tree.
+	 */
+	inline size_type memory_usage() const noexcept {
+		return arena_.memory_usage();
+	}
+
+	/**
+	 * @brief Make the empty tree a balanced tree of entries in time linear in their number.
+	 *
+	 * @param entries with strictly increasing keys.
+	 */
+	void assign(const std::vector<entry_type>& entries) noexcept(NEX) {
+		assert(size_ == 0 && "Cannot build into a non-empty tree.");
+		root_ = build(entries, 0, entries.size());
+	}
+
+	/**
+	 * @brief Insert a key that is not in the tree.
+	 *
+	 * @param key to insert.
+	 * @param value of the key.
+	 * @param weight of the key.
+	 */
+	void insert(key_type key, value_type value, weight_type weight) noexcept(NEX) {
+		root_ = insert(root_, entry_type{key, value, weight});
+	}
+
+	/**
+	 * @brief Remove a key that is in the tree.
+	 *
+	 * @param key to remove.
+	 */
+	void remove(key_type key) noexcept(NEX) {
+		root_ = remove(root_, key);
+	}
+
+	/**
+	 * @brief Change the weight of a key that is in the tree.
+	 *
+	 * @param key to reweight.
+	 * @param delta to add to the weight of the key.
+	 */
+	void adjust(key_type key, int64_t delta) noexcept(NEX) {
+		auto change = static_cast<weight_type>(delta);
+		for (auto handle = root_;;) {
+			assert(handle != null_ && "Key is not in the tree.");
+			auto node = at(handle);
+			node->total += change;
+			if (node->key == key) {
+				node->weight += change;
+				return;
+			}
+			handle = node->children[node->key < key];
+		}
+	}
+
+	/**
+	 * @brief Sum the weights of the keys strictly less than a key.
+	 *
+	 * @param key to sum the weights before.
+	 * @return the total weight of the smaller keys.
+	 */
+	weight_type weight_before(key_type key) const noexcept {
+		weight_type weight = 0;
+		for (auto handle = root_; handle != null_;) {
+			auto node = at(handle);
+			if (node->key < key) {
+				weight += total(node->children[0]) + node->weight;
+				handle = node->children[1];
+			}
+			else {
+				handle = node->children[0];
+			}
+		}
+		return weight;
+	}
+
+	/**
+	 * @brief Find the key at a weighted position, which is the first key whose weight together
+	 * with the weights of the smaller keys exceeds the position.
+	 *
+	 * @param position less than the total weight.
+	 * @return the value of the key and the position within the weight of the key.
+	 */
+	std::pair<value_type, weight_type> select(weight_type position) const noexcept(NEX) {
+		assert(position < total_weight() && "Position is out of range.");
+		for (auto handle = root_;;) {
+			auto node = at(handle);
+			auto left = total(node->children[0]);
+			if (position < left) {
+				handle = node->children[0];
+				continue;
+			}
+			position -= left;
+			if (position < node->weight) return {node->value, position};
+			position -= node->weight;
+			handle = node->children[1];
+		}
+	}
+
+	/**
+	 * @brief Remove every key.
+	 *
+	 */
+	void clear() noexcept {
+		arena_.clear();
+		root_ = null_;
+		size_ = 0;
+	}
+};
@@ -16,7 +16,6 @@ public:
 
 	using size_type = int;
 	Node();
-	~Node();
 	Node(T key, bool color);
 	Node(T key, bool color, Node* left, Node* right, Node* parent);
 	Node* left();
@@ -35,6 +34,8 @@ public:
 	T key_;
 	//0 means black, 1 means red
 	bool color_;
+	//The number of nodes in the subtree rooted at this node, including itself
+	size_type subtree_size_;
 };
 
 template <typename T> Node<T>::Node() {
@@ -43,10 +44,7 @@ template <typename T> Node<T>::Node() {
 	parent_ = nullptr;
 	key_ = T();
 	color_ = 1;
-};
-
-template <typename T> Node<T>::~Node() {
-
+	subtree_size_ = 1;
 };
 
 template <typename T> Node<T>::Node(T key, bool color) {
@@ -55,6 +53,7 @@ template <typename T> Node<T>::Node(T key, bool color) {
 	parent_ = nullptr;
 	key_ = key;
 	color_ = color;
+	subtree_size_ = 1;
 };
 
 template <typename T> Node<T>::Node(T key, bool color, Node* left, Node* right, Node* parent) {
@@ -63,6 +62,7 @@ template <typename T> Node<T>::Node(T key, bool color, Node* left, Node* right,
 	parent_ = parent;
 	key_ = key;
 	color_ = color;
+	subtree_size_ = 1 + (left ? left->subtree_size_ : 0) + (right ? right->subtree_size_ : 0);
 };
 
 template <typename T> Node<T>* Node<T>::left() {
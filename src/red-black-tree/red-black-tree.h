@@ -8,6 +8,9 @@
  */
 #pragma once
 #include "red-black-tree-node.h"
+#include "../node-pool/node-pool.h"
+#include "../memory-breakdown/memory-breakdown.h"
+#include "../operation-stats/operation-stats.h"
 #include <cassert>
 #include <filesystem>
 #include <ctime>
@@ -20,11 +23,29 @@
 #include <fstream>
 #include <cmath>
 #include <optional>
+#include <memory>
 #include <algorithm>
+#include <iterator>
+#include <utility>
+#include <cstddef>
 #include <stdlib.h>
 
-template <typename Key_>
-class RedBlackTree {
+/**
+ * @brief Self balancing binary search tree.
+ * 
+ * Nodes are allocated by a policy with the same requirements as the XFastTrie allocator. The
+ * allocator is shared by every tree produced by split and merge, so the nodes of related trees
+ * stay in the same slabs and are recycled between them.
+ * 
+ * Rotations and node allocations are reported to an instrumentation policy, as in XFastTrie. The
+ * trees produced by split and merge start with counters of their own.
+ * 
+ * @tparam Key_ is the key type.
+ * @tparam Allocator_ is the node allocator type.
+ * @tparam Stats_ is the instrumentation policy.
+ */
+template <typename Key_, template <typename> class Allocator_ = NodePool, typename Stats_ = NoStats>
+class RedBlackTree : private Stats_ {
     template <typename> friend class Node;
 
 //Implicit types
@@ -36,6 +57,14 @@ public:
     using node_ptr = node_type*;
     using size_type = size_t;
 
+    using tree_type = RedBlackTree<key_type, Allocator_, Stats_>;
+    using tree_ptr = tree_type*;
+
+    using allocator_type = Allocator_<node_type>;
+    using allocator_ptr = std::shared_ptr<allocator_type>;
+
+    using stats_type = Stats_;
+
 //Aliases
 public:
     static constexpr bool black_ = 0;
@@ -48,13 +77,41 @@ public:
      * @brief Construct a new RedBlackTree object
      * 
      */
-	RedBlackTree() {
+	RedBlackTree() : RedBlackTree(std::make_shared<allocator_type>()) {  };
+
+    /**
+     * @brief Construct a new RedBlackTree object that allocates from an existing allocator.
+     * 
+     * @param allocator The allocator to share.
+     */
+    explicit RedBlackTree(allocator_ptr allocator) : allocator_(std::move(allocator)) {
         root_ = nullptr;
         max_ = nullptr;
         min_ = nullptr;
         size_ = 0;
     };
 
+    /**
+     * @brief Construct a new RedBlackTree object from a range of strictly increasing keys in
+     * linear time.
+     * 
+     * @param first key of the range.
+     * @param last key of the range, exclusive.
+     * @param allocator The allocator to share.
+     */
+    template <typename Iterator_>
+    RedBlackTree(Iterator_ first, Iterator_ last, allocator_ptr allocator = std::make_shared<allocator_type>())
+        : RedBlackTree(std::move(allocator)) {
+        std::vector<node_ptr> tree_nodes;
+        for (; first != last; ++first) {
+            assert((tree_nodes.empty() || tree_nodes.back()->key_ < *first) &&
+                   "Keys must be strictly increasing.");
+            tree_nodes.push_back(create_node(*first, black_));
+        }
+        if (!tree_nodes.empty())
+            assign_balanced_tree(tree_nodes);
+    };
+
     /**
      * @brief Destroy the RedBlackTree object
      * 
@@ -73,7 +130,7 @@ public:
      */
     void insert(key_type key) {
         //See insert by node ptr for the implementation
-        insert(new Node<key_type>(key,1));
+        insert(create_node(key,1));
     };
 
     /**
@@ -102,14 +159,14 @@ public:
                 if (node->children_[1] == nullptr) {
                     parent->children_[child_dir] = nullptr;
                     color = node->color_;
-                    delete node;
+                    destroy_node(node);
                 }
                 //Case 2: Node only has a right child, so the node gets replaced by its right child before deletion.
                 else {
                     parent->children_[child_dir] = node->children_[1];
                     node->children_[1]->parent_ = parent;
                     color = node->color_;
-                    delete node;
+                    destroy_node(node);
                 }
 
             }
@@ -119,7 +176,7 @@ public:
                     parent->children_[child_dir] = node->children_[0];
                     node->children_[0]->parent_ = parent;
                     color = node->color_;
-                    delete node;
+                    destroy_node(node);
                 }
                 //Case 4: Node has two children, so the node's key is replaced by its successor and the succesor node gets deleted.
                 else {
@@ -136,10 +193,12 @@ public:
 
                     parent = succ->parent_;
                     color = succ->color_;
-                    delete succ;
+                    destroy_node(succ);
                     
                 }
             }
+            //Every ancestor of the deleted node loses one node from its subtree
+            resize_path(parent, -1);
             //Maintains the RedBlackTree invariant
             remove_check(parent, color, dir);
             
@@ -159,11 +218,9 @@ public:
                     root_->parent_ = nullptr;
                     root_->color_ = black_;
                 }
-                //Case 5.5: Root has no children, so just delete the root.
-                else {
-                    delete node;
-                }
-                
+                //Case 5.5: Root has no children, so the tree becomes empty.
+                destroy_node(node);
+
             }
             //Case 6: Root has successor, so replace the root's key with the successor's key and delete the successor
             else {
@@ -177,7 +234,9 @@ public:
                 parent = succ->parent_;
                 dir = succ->parent_->children_[1] == succ;
                 color = succ->color_;
-                delete succ;
+                destroy_node(succ);
+                //Every ancestor of the deleted node loses one node from its subtree
+                resize_path(parent, -1);
                 //Maintains the RedBlackTree invariant
                 remove_check(parent, color, dir);
             }
@@ -193,6 +252,10 @@ public:
     void clear() {
         //See this recursive submethod to see the actual process
         clear(root_);
+        root_ = nullptr;
+        max_ = nullptr;
+        min_ = nullptr;
+        size_ = 0;
     };
 
 private:
@@ -208,6 +271,7 @@ private:
         node->children_[0] = nullptr;
         node->children_[1] = nullptr;
         node->parent_ = nullptr;
+        node->subtree_size_ = 1;
 
         max_ = nullptr;
         min_ = nullptr;
@@ -229,6 +293,7 @@ private:
                     target_node->children_[dir] = node;
                     node->parent_ = target_node;
                     size_++;
+                    resize_path(target_node, 1);
                     insert_check(node);
                     return;
                 }
@@ -236,9 +301,9 @@ private:
                     target_node = target_node->children_[dir];
                 }
             }
-            // yeeet bug
+            //Case 3: The key is already in the tree, so recycle the node.
             if (target_node->key_ == key){
-                delete node;
+                destroy_node(node);
             }
         }
     };
@@ -252,42 +317,62 @@ public:
      * @param n The index of the desired element.
      * @return some_key_type 
      */
-    some_key_type get(size_type n) {
-        if(!min_) {return std::nullopt;}
-        if( n <= 0 && min_) {return some_key_type(min_->key_);}
-        if (n >= size_ - 1){
-            if(max_){
-                return some_key_type(max_->key_);
-            }else{
-                return std::nullopt;
-            }
-        }
-        auto key = min_->key_;
-    
-        for (int i = 1; i <= n; i++){
-            key = *successor(key);
-        }
-        return some_key_type(key);
-        
+    some_key_type get(size_type n) const {
+        if (!root_) {return std::nullopt;}
+        if (n >= size_) {n = size_ - 1;}
+        return select(n);
     };
 
     /**
      * @brief Returns the median key of the tree. If the tree has an even number of nodes, it gives the greater key of the two middle keys.
-     * If the tree has no nodes, std::nullopt is returned.
      * 
-     * @return some_key_type 
+     * @return key_type The median key.
      */
-    key_type median() {
+    key_type median() const {
         assert(root_ && "Use of median on an empty tree is not supported");
-        //Gets vector with all keys
-        std::vector<key_type> keys;
-        for (auto node : nodes()) {
-            keys.push_back(node->key_);
+        return select(size_ / 2).value();
+    };
+
+    /**
+     * @brief Counts the keys in the tree that are strictly less than the input key, using the subtree sizes.
+     * 
+     * @param key The key to rank.
+     * @return size_type The number of keys less than the key.
+     */
+    size_type rank(key_type key) const {
+        size_type count = 0;
+        auto node = root_;
+        while (node) {
+            if (node->key_ < key) {
+                count += subtree_size(node->children_[0]) + 1;
+                node = node->children_[1];
+            } else {
+                node = node->children_[0];
+            }
         }
-        //Sets the "middle" of the vector to be the median
-        std::nth_element(keys.begin(), keys.begin() + keys.size()/2, keys.end());
+        return count;
+    };
 
-        return keys[keys.size() / 2];
+    /**
+     * @brief Finds the key with the input index in increasing order, using the subtree sizes.
+     * 
+     * @param index The index of the key, starting from 0.
+     * @return some_key_type The key, or nullopt if the index is not less than the size of the tree.
+     */
+    some_key_type select(size_type index) const {
+        if (index >= size_) return std::nullopt;
+        auto node = root_;
+        while (true) {
+            auto left_size = subtree_size(node->children_[0]);
+            if (index < left_size) {
+                node = node->children_[0];
+            } else if (index == left_size) {
+                return some_key_type(node->key_);
+            } else {
+                index -= left_size + 1;
+                node = node->children_[1];
+            }
+        }
     };
 
     /**
@@ -296,7 +381,7 @@ public:
      * @param key The key of the node that is being searched for.
      * @return node_ptr The node that had the input key, or nullptr if that does not exist.
      */
-    node_ptr find(key_type key){
+    node_ptr find(key_type key) const {
         auto target_node = root_;
         while (target_node != nullptr && target_node->key_ != key) {
             target_node = target_node->children_[key > target_node->key_];
@@ -311,7 +396,7 @@ public:
      * @return true if the key is in the tree.
      * @return false if the key is not in the tree.
      */
-    bool contains(key_type key) {
+    bool contains(key_type key) const {
         return find(key) != nullptr;
     };
 
@@ -323,7 +408,7 @@ public:
      * Returns nullopt if <key> is not in the tree, or there is no value less than the input value in the tree.
      * 
      */
-    some_key_type predecessor(key_type key) {
+    some_key_type predecessor(key_type key) const {
 
         if(!root_) return std::nullopt;
 
@@ -372,7 +457,7 @@ public:
      * Returns nullopt if <key> is not in the tree, or there is no value greater than the input value.
      * 
      */
-    some_key_type successor(key_type key) {
+    some_key_type successor(key_type key) const {
         
         if(!root_) return std::nullopt;
 
@@ -420,7 +505,7 @@ public:
      * 
      * @return some_key_type The maximum of the tree, which may be none if the tree is empty.
      */
-    some_key_type max() {
+    some_key_type max() const {
         // if (max_) return some_key_type(max_->key());
         if (!root_) return some_key_type();
         auto max_ = root_;
@@ -435,7 +520,7 @@ public:
      * 
      * @return some_key_type The minimum of the tree, which may be none if the tree is empty.
      */
-    some_key_type min() {
+    some_key_type min() const {
         // if (min_) return some_key_type(min_->key());
         if (!root_) return some_key_type();
         auto min_ = root_;
@@ -443,6 +528,131 @@ public:
         return some_key_type(min_->key());
     };
 
+//Iterators
+public:
+
+    /**
+     * @brief Bidirectional iterator over the keys of the tree in increasing order.
+     * 
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = key_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const key_type*;
+        using reference = const key_type&;
+
+    private:
+        const tree_type* tree_;
+        node_ptr node_;
+
+    public:
+        /**
+         * @brief Construct a new const_iterator object.
+         * 
+         * @param tree The tree to iterate over.
+         * @param node The current node, or nullptr for the end of the tree.
+         */
+        const_iterator(const tree_type* tree = nullptr, node_ptr node = nullptr) : tree_(tree), node_(node) {  };
+
+        reference operator*() const { return node_->key_; };
+        pointer operator->() const { return &node_->key_; };
+
+        /**
+         * @brief Move to the inorder successor, following the parent pointers when the current
+         * node has no right subtree.
+         * 
+         * @return const_iterator& The iterator.
+         */
+        const_iterator& operator++() {
+            if (node_->children_[1]) {
+                node_ = node_->children_[1];
+                while (node_->children_[0]) node_ = node_->children_[0];
+                return *this;
+            }
+            auto parent = node_->parent_;
+            while (parent && node_ == parent->children_[1]) {
+                node_ = parent;
+                parent = parent->parent_;
+            }
+            node_ = parent;
+            return *this;
+        };
+
+        /**
+         * @brief Move to the inorder predecessor. Decrementing the end of the tree moves to the
+         * maximum.
+         * 
+         * @return const_iterator& The iterator.
+         */
+        const_iterator& operator--() {
+            if (!node_) {
+                node_ = tree_->root_;
+                while (node_->children_[1]) node_ = node_->children_[1];
+                return *this;
+            }
+            if (node_->children_[0]) {
+                node_ = node_->children_[0];
+                while (node_->children_[1]) node_ = node_->children_[1];
+                return *this;
+            }
+            auto parent = node_->parent_;
+            while (parent && node_ == parent->children_[0]) {
+                node_ = parent;
+                parent = parent->parent_;
+            }
+            node_ = parent;
+            return *this;
+        };
+
+        const_iterator operator++(int) { auto it = *this; ++(*this); return it; };
+        const_iterator operator--(int) { auto it = *this; --(*this); return it; };
+
+        bool operator==(const const_iterator& other) const { return node_ == other.node_; };
+        bool operator!=(const const_iterator& other) const { return node_ != other.node_; };
+    };
+
+    /**
+     * @brief Returns an iterator to the minimum key of the tree.
+     * 
+     * @return const_iterator The iterator, which is the end of the tree if the tree is empty.
+     */
+    const_iterator begin() const {
+        auto node = root_;
+        while (node && node->children_[0]) node = node->children_[0];
+        return const_iterator(this, node);
+    };
+
+    /**
+     * @brief Returns an iterator past the maximum key of the tree.
+     * 
+     * @return const_iterator The iterator.
+     */
+    const_iterator end() const {
+        return const_iterator(this, nullptr);
+    };
+
+    /**
+     * @brief Returns an iterator to the smallest key that is greater than or equal to the input key.
+     * 
+     * @param key The key to search for.
+     * @return const_iterator The iterator, which is the end of the tree if no such key exists.
+     */
+    const_iterator lower_bound(key_type key) const {
+        node_ptr bound = nullptr;
+        auto node = root_;
+        while (node) {
+            if (node->key_ >= key) {
+                bound = node;
+                node = node->children_[0];
+            } else {
+                node = node->children_[1];
+            }
+        }
+        return const_iterator(this, bound);
+    };
+
 //Split/merge
 public:
 
@@ -453,6 +663,7 @@ private:
 	size_type size_;
     node_ptr max_;
     node_ptr min_;
+    allocator_ptr allocator_;
 
 //Class constants
 private:
@@ -632,7 +843,7 @@ private:
         if (node) {
             clear(node->children_[0]);
             clear(node->children_[1]);
-            delete node;
+            destroy_node(node);
         }
     };
 public:
@@ -646,7 +857,7 @@ public:
      * 
      * @return left tree with values less than the median and a right tree with all other values.
      */
-    std::array<RedBlackTree<key_type>*,2>  split() {
+    std::array<tree_ptr,2>  split() {
         assert(root_ && (size() > 1) && 
                "Cannot split a tree with size 0 or 1");
 
@@ -671,7 +882,7 @@ public:
         min_ = nullptr;
         size_ = 0;
 
-        return std::array<RedBlackTree<key_type>*, 2>{left_tree, right_tree};
+        return std::array<tree_ptr, 2>{left_tree, right_tree};
     };
 
     /**
@@ -681,9 +892,9 @@ public:
      * 
      * @param left_tree with values strictly less than the right tree.
      * @param right_tree with values strictly greater than the left tree.
-     * @return the merged tree.
+     * @return the merged tree, which allocates from the allocator of the current tree.
      */
-    RedBlackTree<key_type>* merge(RedBlackTree<key_type>* left_tree, RedBlackTree<key_type>* right_tree) {
+    tree_ptr merge(tree_ptr left_tree, tree_ptr right_tree) {
         assert(left_tree->root_ && right_tree->root_ && (left_tree->size() > 0) && (right_tree->size() > 0) &&
                "Cannot merge empty trees.");
         assert(left_tree->max().value() < right_tree->min().value() &&
@@ -692,10 +903,15 @@ public:
         // Collect all the nodes into a vector.
         std::vector<node_ptr> tree_nodes;
         tree_nodes.reserve(left_tree->size() + right_tree->size());
-        //bug must be sorted
         nodes(left_tree->root_, tree_nodes);
         nodes(right_tree->root_, tree_nodes);
 
+        // Nodes from another allocator are copied into the allocator of the current tree, so
+        // that the merged tree owns all of its nodes.
+        auto right_tree_begin = tree_nodes.begin() + left_tree->size();
+        adopt(left_tree, tree_nodes.begin(), right_tree_begin);
+        adopt(right_tree, right_tree_begin, tree_nodes.end());
+
         // Create a new tree from the nodes.
         auto merged_tree = nodes_to_balanced_tree(tree_nodes);
 
@@ -713,7 +929,68 @@ public:
         return merged_tree;
     };
 
+    /**
+     * @brief Build a new tree from a range of strictly increasing keys in linear time.
+     * 
+     * @param first key of the range.
+     * @param last key of the range, exclusive.
+     * @return the new tree, which allocates from the allocator of the current tree.
+     */
+    template <typename Iterator_>
+    tree_ptr build(Iterator_ first, Iterator_ last) {
+        return new tree_type(first, last, allocator_);
+    };
+
 private:
+    /**
+     * @brief Gives the instrumentation policy, which is an empty base when nothing is counted.
+     * 
+     * @return const stats_type& The instrumentation policy.
+     */
+    const stats_type& stats() const {
+        return *this;
+    };
+
+    /**
+     * @brief Creates a node with the allocator of the tree.
+     * 
+     * @param args The arguments to forward to the node constructor.
+     * @return node_ptr The new node.
+     */
+    template <typename... Args>
+    node_ptr create_node(Args&&... args) {
+        stats().count_node_allocation();
+        return allocator_->create(std::forward<Args>(args)...);
+    };
+
+    /**
+     * @brief Destroys a node with the allocator of the tree.
+     * 
+     * @param node The node to destroy.
+     */
+    void destroy_node(node_ptr node) {
+        stats().count_node_free();
+        allocator_->destroy(node);
+    };
+
+    /**
+     * @brief Move nodes of another tree into the allocator of the current tree, if the trees use
+     * different allocators.
+     * 
+     * @param tree that owns the nodes.
+     * @param first node to move.
+     * @param last node to move, exclusive.
+     */
+    void adopt(tree_ptr tree, typename std::vector<node_ptr>::iterator first,
+               typename std::vector<node_ptr>::iterator last) {
+        if (tree->allocator_ == allocator_) return;
+        for (auto it = first; it != last; ++it) {
+            auto node = *it;
+            *it = create_node(node->key_, node->color_);
+            tree->destroy_node(node);
+        }
+    }
+
     /**
      * @brief Convert a sorted vector of nodes to a balanced red-black tree.
      * 
@@ -722,8 +999,21 @@ private:
      * @param tree_nodes to construct a red-black tree from.
      * @return the red black tree.
      */
-    RedBlackTree<key_type>* nodes_to_balanced_tree(std::vector<node_ptr>& tree_nodes) {
+    tree_ptr nodes_to_balanced_tree(std::vector<node_ptr>& tree_nodes) {
+        // Initialize the merged tree. It shares the allocator of the current tree.
+        auto merged_tree = new tree_type(allocator_);
+        merged_tree->assign_balanced_tree(tree_nodes);
+        return merged_tree;
+    }
+
+    /**
+     * @brief Make the current empty tree a balanced red-black tree of a sorted vector of nodes.
+     * 
+     * @param tree_nodes to construct the red-black tree from.
+     */
+    void assign_balanced_tree(std::vector<node_ptr>& tree_nodes) {
         assert(!tree_nodes.empty() && "Cannot build a tree from 0 nodes.");
+        assert(root_ == nullptr && "Cannot build into a non-empty tree.");
 
         // Create a vector to store nodes that should be marked red.
         std::vector<node_ptr> mark_red;
@@ -731,26 +1021,22 @@ private:
 
         // Construct a balanced tree without correct coloring.
         int max_depth = 0;
-        auto merged_root = construct_all_black_balanced_tree(tree_nodes, mark_red, nullptr, 0, tree_nodes.size() - 1, 0, max_depth);
+        root_ = construct_all_black_balanced_tree(tree_nodes, mark_red, nullptr, 0, tree_nodes.size() - 1, 0, max_depth);
 
-        // Correct the coloring.
+        // Correct the coloring. A single node is on the deepest level, but the root must be black.
         for (auto node : mark_red)
             node->color_ = red_;
+        root_->color_ = black_;
         
-        // Initialize the merged tree.
-        auto merged_tree = new RedBlackTree<key_type>();
-        merged_tree->root_ = merged_root;
-        merged_tree->size_ = tree_nodes.size();
-        merged_tree->min_ = *tree_nodes.begin();
-        merged_tree->max_ = *(--tree_nodes.end());
+        size_ = tree_nodes.size();
+        min_ = *tree_nodes.begin();
+        max_ = *(--tree_nodes.end());
         
         // Check some post conditions.
-        assert(!merged_tree->empty());
-        assert(merged_tree->max().value() == merged_tree->max_->key_);
-        assert(merged_tree->min().value() == merged_tree->min_->key_);
-
-        return merged_tree;
-    }  
+        assert(!empty());
+        assert(max().value() == max_->key_);
+        assert(min().value() == min_->key_);
+    }
 
     /**
      * @brief Construct an all black balanced binary tree from a vector of nodes.
@@ -798,9 +1084,10 @@ private:
         root->children_[0] = construct_all_black_balanced_tree(tree_nodes, mark_red, root, start, mid - 1, depth + 1, max_depth);
         root->children_[1] = construct_all_black_balanced_tree(tree_nodes, mark_red, root, mid + 1, end, depth + 1, max_depth);
 
-        // Update the parent and color of the current node.
+        // Update the parent, color and subtree size of the current node.
         root->parent_ = parent;
         root->color_ = black_;
+        update_subtree_size(root);
 
         return root;   
     }
@@ -817,6 +1104,8 @@ private:
      * @return node_ptr The new root of the rotated subtree.
      */
     node_ptr rotate(node_ptr root, bool side) {
+        stats().count_rotation();
+
         //The result of the rotation is shown below in ascii art.
         //The left shows the result of left rotation, and the right is the result of right rotation
         //Whichever is the original tree is up for you to decide, lol.
@@ -842,6 +1131,10 @@ private:
             root_ = root->parent_;
             root->parent_->parent_ = nullptr;
 
+            //The rotated node is now below its old child, so its size is recomputed first.
+            update_subtree_size(root);
+            update_subtree_size(root_);
+
             return root_;
         }
         else {
@@ -865,10 +1158,46 @@ private:
 
             root->parent_->parent_ = parent;
 
+            update_subtree_size(root);
+            update_subtree_size(root->parent_);
+
             return root->parent_;
         }
     };
 
+//Subtree sizes
+private:
+
+    /**
+     * @brief Returns the number of nodes in a subtree.
+     * 
+     * @param node The root of the subtree, which may be nullptr.
+     * @return size_type The number of nodes in the subtree.
+     */
+    static size_type subtree_size(node_ptr node) {
+        return node ? node->subtree_size_ : 0;
+    };
+
+    /**
+     * @brief Recomputes the subtree size of a node from the subtree sizes of its children.
+     * 
+     * @param node The node to update.
+     */
+    static void update_subtree_size(node_ptr node) {
+        node->subtree_size_ = 1 + subtree_size(node->children_[0]) + subtree_size(node->children_[1]);
+    };
+
+    /**
+     * @brief Adds to the subtree size of a node and of all of its ancestors.
+     * 
+     * @param node The lowest node whose subtree changed size.
+     * @param delta The change in size.
+     */
+    static void resize_path(node_ptr node, int delta) {
+        for (; node != nullptr; node = node->parent_)
+            node->subtree_size_ += delta;
+    };
+
 //Member getters
 public:
 
@@ -877,10 +1206,61 @@ public:
      * 
      * @return node_ptr The size of the tree
      */
-    size_type size() {
+    size_type size() const {
         return size_;
     };
 
+    /**
+     * @brief Gives the heap memory of the tree by category. The nodes are counted from the size of
+     * the tree and the slack is that of the allocator, which is shared with the trees produced by
+     * split and merge.
+     * 
+     * @return MemoryBreakdown The memory of the nodes and of the unused slots of the allocator.
+     */
+    MemoryBreakdown memory_breakdown() const {
+        MemoryBreakdown breakdown;
+        breakdown.nodes = size_ * sizeof(node_type);
+        breakdown.slack = allocator_->memory_usage() - allocator_->size() * sizeof(node_type);
+        return breakdown;
+    };
+
+    /**
+     * @brief Gives the heap memory of the tree.
+     * 
+     * @return size_type The number of bytes allocated for the tree.
+     */
+    size_type memory_usage() const {
+        return memory_breakdown().total();
+    };
+
+    /**
+     * @brief Gives the work done by the operations on the tree since it was created or its
+     * counters were last reset. Every counter is 0 unless the tree is instrumented with
+     * OperationStats.
+     * 
+     * @return OperationCounters A snapshot of the counters.
+     */
+    OperationCounters operation_counters() const {
+        return stats().snapshot();
+    };
+
+    /**
+     * @brief Sets every operation counter to 0.
+     * 
+     */
+    void reset_operation_counters() {
+        stats().reset();
+    };
+
+    /**
+     * @brief Gives the number of bytes that the tree allocates outside of itself for each key.
+     * 
+     * @return size_type The size of a node.
+     */
+    static constexpr size_type memory_per_key() {
+        return sizeof(node_type);
+    };
+
     /**
      * @brief Returns the lower bound of the data type of the tree.
      * 
@@ -928,7 +1308,7 @@ public:
      * @return true if tree is empty.
      * @return false if tree has one or more nodes.
      */
-    bool empty(){
+    bool empty() const {
         return !root_;
     }
 
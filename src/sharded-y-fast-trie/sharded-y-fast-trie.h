@@ -0,0 +1,367 @@
+/**
+ * @file sharded-y-fast-trie.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief ShardedYFastTrie class template.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "../y-fast-trie/y-fast-trie.h"
+#include "../constants.h"
+#include <optional>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <limits>
+#include <cstdint>
+
+/**
+ * @brief Thread safe ordered set that splits the universe into shards by the high bits of the
+ * keys and stores each shard in its own YFastTrie.
+ *
+ * Every shard has its own lock and its own allocators, so threads that update keys in different
+ * shards never wait for each other. A bitmap with one bit per non-empty shard lets predecessor,
+ * successor, min and max skip over empty shards without taking their locks. When the keys are
+ * spread uniformly over the universe, updates scale with the number of threads until the threads
+ * start to collide on the same shards.
+ *
+ * @tparam Key_ is the key type.
+ * @tparam Shards_ is the number of shards, which must be a power of two.
+ * @tparam Bucket_ is the bucket type.
+ * @tparam Map_ is the hash table type. See XFastTrie for the requirements.
+ */
+template <typename Key_, size_t Shards_ = 64, typename Bucket_ = RedBlackTree<Key_>,
+          template <typename, typename> class Map_ = flat_map>
+class ShardedYFastTrie {
+public:
+	using key_type = Key_;
+	using some_key_type = std::optional<key_type>;
+	using size_type = size_t;
+
+private:
+	using trie_type = YFastTrie<key_type, Bucket_, Map_>;
+	using mutex_type = std::shared_mutex;
+	using word_type = uint64_t;
+
+	/**
+	 * @brief Shard of the universe. Each shard starts on its own cache line, so that locking one
+	 * shard does not slow down the threads working on its neighbors.
+	 *
+	 */
+	struct alignas(64) shard_type {
+		mutable mutex_type mutex;
+		trie_type trie;
+	};
+
+	/**
+	 * @brief Compute the log base 2 of a power of two.
+	 *
+	 * @param value is the power of two.
+	 * @return the log base 2.
+	 */
+	static constexpr size_type log2(size_type value) noexcept {
+		size_type bits = 0;
+		while (value > 1) {
+			value >>= 1;
+			bits += 1;
+		}
+		return bits;
+	}
+
+private:
+	// Number of shards.
+	static constexpr size_type shard_count_ = Shards_;
+
+	// Number of high key bits that select the shard.
+	static constexpr size_type shard_bits_ = log2(shard_count_);
+
+	// Number of bits in an occupancy word.
+	static constexpr size_type word_bits_ = std::numeric_limits<word_type>::digits;
+
+	// Number of occupancy words.
+	static constexpr size_type word_count_ = (shard_count_ + word_bits_ - 1) / word_bits_;
+
+	static_assert(shard_count_ > 0 && (shard_count_ & (shard_count_ - 1)) == 0,
+	              "Number of shards must be a power of two.");
+	static_assert(shard_bits_ <= trie_type::bit_length(),
+	              "Number of shards must not exceed the size of the universe.");
+
+private:
+	std::vector<shard_type> shards_;
+
+	// Bit i of the bitmap is set if and only if shard i is not empty. Bits are only changed while
+	// the lock of their shard is held, but are read without any lock.
+	std::array<std::atomic<word_type>, word_count_> occupied_;
+
+	std::atomic<size_type> size_;
+
+private:
+	/**
+	 * @brief Get the index of the shard that a key belongs to.
+	 *
+	 * @param key to get the shard of.
+	 * @return the shard index.
+	 */
+	static constexpr size_type get_shard_index(key_type key) noexcept {
+		if constexpr (shard_bits_ == 0) return 0;
+		else return static_cast<size_type>(key >> (trie_type::bit_length() - shard_bits_));
+	}
+
+	/**
+	 * @brief Mark a shard as empty or not empty.
+	 *
+	 * @param index of the shard, whose lock must be held exclusively.
+	 */
+	void update_occupied(size_type index) noexcept {
+		auto bit = word_type(1) << (index % word_bits_);
+		auto& word = occupied_[index / word_bits_];
+		if (shards_[index].trie.empty()) word.fetch_and(~bit, std::memory_order_relaxed);
+		else word.fetch_or(bit, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Find the next shard that was not empty when the bitmap was read.
+	 *
+	 * @param index of the first shard to check.
+	 * @return the shard index or shard_count_ if there is none.
+	 */
+	size_type next_occupied(size_type index) const noexcept {
+		if (index >= shard_count_) return shard_count_;
+		auto word_index = index / word_bits_;
+		auto word = occupied_[word_index].load(std::memory_order_relaxed);
+		word &= ~word_type(0) << (index % word_bits_);
+		while (word == 0) {
+			if (++word_index == word_count_) return shard_count_;
+			word = occupied_[word_index].load(std::memory_order_relaxed);
+		}
+		return word_index * word_bits_ + __builtin_ctzll(word);
+	}
+
+	/**
+	 * @brief Find the previous shard that was not empty when the bitmap was read.
+	 *
+	 * @param index of the first shard to check, which may be -1.
+	 * @return the shard index or -1 if there is none.
+	 */
+	size_type prev_occupied(size_type index) const noexcept {
+		if (index == size_type(-1)) return index;
+		auto word_index = index / word_bits_;
+		auto word = occupied_[word_index].load(std::memory_order_relaxed);
+		word &= ~word_type(0) >> (word_bits_ - 1 - index % word_bits_);
+		while (word == 0) {
+			if (word_index-- == 0) return size_type(-1);
+			word = occupied_[word_index].load(std::memory_order_relaxed);
+		}
+		return word_index * word_bits_ + word_bits_ - 1 - __builtin_clzll(word);
+	}
+
+	/**
+	 * @brief Find the minimum key of the first non-empty shard at or after an index.
+	 *
+	 * @param index of the first shard to check.
+	 * @return some_key_type minimum key if there is a non-empty shard.
+	 * @return none_key_type if there is no non-empty shard.
+	 */
+	some_key_type min_from(size_type index) const noexcept(NEX) {
+		// A shard may be emptied after its bit is read, so the search continues until a shard
+		// answers.
+		for (index = next_occupied(index); index < shard_count_; index = next_occupied(index + 1)) {
+			std::shared_lock<mutex_type> lock(shards_[index].mutex);
+			auto key = shards_[index].trie.min();
+			if (key) return key;
+		}
+		return some_key_type();
+	}
+
+	/**
+	 * @brief Find the maximum key of the last non-empty shard at or before an index.
+	 *
+	 * @param index of the first shard to check, which may be -1.
+	 * @return some_key_type maximum key if there is a non-empty shard.
+	 * @return none_key_type if there is no non-empty shard.
+	 */
+	some_key_type max_from(size_type index) const noexcept(NEX) {
+		for (index = prev_occupied(index); index != size_type(-1); index = prev_occupied(index - 1)) {
+			std::shared_lock<mutex_type> lock(shards_[index].mutex);
+			auto key = shards_[index].trie.max();
+			if (key) return key;
+		}
+		return some_key_type();
+	}
+
+public:
+	/**
+	 * @brief Get the bit length of the key type.
+	 *
+	 * @return constexpr size_type bit length of the key type.
+	 */
+	static constexpr size_type bit_length() noexcept {
+		return trie_type::bit_length();
+	}
+
+	/**
+	 * @brief Get the maximum key.
+	 *
+	 * @return constexpr key_type maximum key.
+	 */
+	static constexpr key_type upper_bound() noexcept {
+		return trie_type::upper_bound();
+	}
+
+	/**
+	 * @brief Get the minimum key.
+	 *
+	 * @return constexpr key_type minimum key.
+	 */
+	static constexpr key_type lower_bound() noexcept {
+		return trie_type::lower_bound();
+	}
+
+	/**
+	 * @brief Get the number of shards.
+	 *
+	 * @return constexpr size_type number of shards.
+	 */
+	static constexpr size_type shard_count() noexcept {
+		return shard_count_;
+	}
+
+public:
+	/**
+	 * @brief Construct a new ShardedYFastTrie object.
+	 *
+	 */
+	ShardedYFastTrie() : shards_(shard_count_), size_(0) {
+		for (auto& word : occupied_)
+			word.store(0, std::memory_order_relaxed);
+	}
+
+	ShardedYFastTrie(const ShardedYFastTrie&) = delete;
+	ShardedYFastTrie& operator=(const ShardedYFastTrie&) = delete;
+
+	/**
+	 * @brief Get the number of keys in the trie. Concurrent updates may not be reflected yet.
+	 *
+	 * @return size_type number of keys in the trie.
+	 */
+	inline size_type size() const noexcept {
+		return size_.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Check if the trie is empty. Concurrent updates may not be reflected yet.
+	 *
+	 * @return true if the trie is empty.
+	 * @return false if the trie is not empty.
+	 */
+	inline bool empty() const noexcept {
+		return size() == 0;
+	}
+
+	/**
+	 * @brief Check if the trie contains a key.
+	 *
+	 * @param key to check if the trie contains.
+	 * @return true if the trie contains the key.
+	 * @return false if the trie does not contain the key.
+	 */
+	bool contains(key_type key) const noexcept(NEX) {
+		auto& shard = shards_[get_shard_index(key)];
+		std::shared_lock<mutex_type> lock(shard.mutex);
+		return shard.trie.contains(key);
+	}
+
+	/**
+	 * @brief Find the predecessor of a key.
+	 *
+	 * @param key to find the predecessor of.
+	 * @return some_key_type predecessor key if the predecessor exists.
+	 * @return none_key_type if the predecessor does not exist.
+	 */
+	some_key_type predecessor(key_type key) const noexcept(NEX) {
+		auto index = get_shard_index(key);
+		{
+			std::shared_lock<mutex_type> lock(shards_[index].mutex);
+			auto predecessor = shards_[index].trie.predecessor(key);
+			if (predecessor) return predecessor;
+		}
+
+		// Every key of an earlier shard is less than the key.
+		return max_from(index - 1);
+	}
+
+	/**
+	 * @brief Find the successor of a key.
+	 *
+	 * @param key to find the successor of.
+	 * @return some_key_type successor key if the successor exists.
+	 * @return none_key_type if the successor does not exist.
+	 */
+	some_key_type successor(key_type key) const noexcept(NEX) {
+		auto index = get_shard_index(key);
+		{
+			std::shared_lock<mutex_type> lock(shards_[index].mutex);
+			auto successor = shards_[index].trie.successor(key);
+			if (successor) return successor;
+		}
+
+		// Every key of a later shard is greater than the key.
+		return min_from(index + 1);
+	}
+
+	/**
+	 * @brief Find the minimum key.
+	 *
+	 * @return some_key_type minimum key if trie is not empty.
+	 * @return none_key_type if the trie is empty.
+	 */
+	some_key_type min() const noexcept(NEX) {
+		return min_from(0);
+	}
+
+	/**
+	 * @brief Find the maximum key.
+	 *
+	 * @return some_key_type maximum key if trie is not empty.
+	 * @return none_key_type if the trie is empty.
+	 */
+	some_key_type max() const noexcept(NEX) {
+		return max_from(shard_count_ - 1);
+	}
+
+	/**
+	 * @brief Insert a key into the trie.
+	 *
+	 * @param key to insert into the trie.
+	 */
+	void insert(key_type key) noexcept(NEX) {
+		auto index = get_shard_index(key);
+		auto& shard = shards_[index];
+		std::unique_lock<mutex_type> lock(shard.mutex);
+		auto old_size = shard.trie.size();
+		shard.trie.insert(key);
+		if (shard.trie.size() == old_size) return;
+		if (old_size == 0) update_occupied(index);
+		size_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * @brief Remove a key from the trie.
+	 *
+	 * @param key to remove from the trie.
+	 */
+	void remove(key_type key) noexcept(NEX) {
+		auto index = get_shard_index(key);
+		auto& shard = shards_[index];
+		std::unique_lock<mutex_type> lock(shard.mutex);
+		auto old_size = shard.trie.size();
+		shard.trie.remove(key);
+		if (shard.trie.size() == old_size) return;
+		if (old_size == 1) update_occupied(index);
+		size_.fetch_sub(1, std::memory_order_relaxed);
+	}
+};
@@ -0,0 +1,322 @@
+/**
+ * @file sorted-array-bucket-search.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Search policies for SortedArrayBucket.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ */
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SORTED_ARRAY_BUCKET_X86 1
+#include <immintrin.h>
+#else
+#define SORTED_ARRAY_BUCKET_X86 0
+#endif
+
+/**
+ * @brief Search policy that ranks a key with a branchless binary search.
+ *
+ */
+struct BranchlessSearch {
+	/**
+	 * @brief Count the keys strictly less than a given key.
+	 *
+	 * @param keys is a sorted array.
+	 * @param size is the number of keys in the array.
+	 * @param key to rank.
+	 * @return the number of keys less than the key.
+	 */
+	template <typename Key_>
+	static inline size_t rank(const Key_* keys, size_t size, Key_ key) noexcept {
+		if (size == 0) return 0;
+		const Key_* base = keys;
+		size_t n = size;
+		while (n > 1) {
+			size_t half = n >> 1;
+			base = (base[half] < key) ? base + half : base;
+			n -= half;
+		}
+		return (base - keys) + (*base < key);
+	}
+};
+
+/**
+ * @brief Kernels that count the keys strictly less than a given key in a short array. Each
+ * kernel compares a broadcast key against a full vector of keys and counts the matching lanes
+ * with a movemask and a popcount.
+ *
+ */
+namespace sorted_array_bucket_kernels {
+
+	template <typename Key_>
+	using count_less_fn = size_t (*)(const Key_*, size_t, Key_);
+
+	/**
+	 * @brief Portable fallback kernel.
+	 *
+	 */
+	struct scalar {
+		static inline bool supported() noexcept { return true; }
+
+		template <typename Key_>
+		static size_t count_less(const Key_* keys, size_t size, Key_ key) noexcept {
+			size_t count = 0;
+			for (size_t i = 0; i < size; ++i)
+				count += keys[i] < key;
+			return count;
+		}
+	};
+
+#if SORTED_ARRAY_BUCKET_X86
+
+	/**
+	 * @brief SSE4.2 kernels. Unsigned comparisons are done on signed lanes by flipping the sign
+	 * bits of both operands.
+	 *
+	 */
+	struct sse42 {
+		static inline bool supported() noexcept {
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+		}
+
+		__attribute__((target("sse4.2,popcnt")))
+		static size_t count_less(const uint8_t* keys, size_t size, uint8_t key) noexcept {
+			const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+			const __m128i pivot = _mm_xor_si128(_mm_set1_epi8(static_cast<char>(key)), bias);
+			size_t count = 0, i = 0;
+			for (; i + 16 <= size; i += 16) {
+				auto lanes = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), bias);
+				count += _mm_popcnt_u32(_mm_movemask_epi8(_mm_cmpgt_epi8(pivot, lanes)));
+			}
+			return count + scalar::count_less(keys + i, size - i, key);
+		}
+
+		__attribute__((target("sse4.2,popcnt")))
+		static size_t count_less(const uint16_t* keys, size_t size, uint16_t key) noexcept {
+			const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+			const __m128i pivot = _mm_xor_si128(_mm_set1_epi16(static_cast<short>(key)), bias);
+			size_t count = 0, i = 0;
+			for (; i + 8 <= size; i += 8) {
+				auto lanes = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), bias);
+				count += _mm_popcnt_u32(_mm_movemask_epi8(_mm_cmpgt_epi16(pivot, lanes))) >> 1;
+			}
+			return count + scalar::count_less(keys + i, size - i, key);
+		}
+
+		__attribute__((target("sse4.2,popcnt")))
+		static size_t count_less(const uint32_t* keys, size_t size, uint32_t key) noexcept {
+			const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+			const __m128i pivot = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(key)), bias);
+			size_t count = 0, i = 0;
+			for (; i + 4 <= size; i += 4) {
+				auto lanes = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), bias);
+				count += _mm_popcnt_u32(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(pivot, lanes))));
+			}
+			return count + scalar::count_less(keys + i, size - i, key);
+		}
+
+		__attribute__((target("sse4.2,popcnt")))
+		static size_t count_less(const uint64_t* keys, size_t size, uint64_t key) noexcept {
+			const __m128i bias = _mm_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+			const __m128i pivot = _mm_xor_si128(_mm_set1_epi64x(static_cast<long long>(key)), bias);
+			size_t count = 0, i = 0;
+			for (; i + 2 <= size; i += 2) {
+				auto lanes = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)), bias);
+				count += _mm_popcnt_u32(_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(pivot, lanes))));
+			}
+			return count + scalar::count_less(keys + i, size - i, key);
+		}
+	};
+
+	/**
+	 * @brief AVX2 kernels. Same as the SSE4.2 kernels on twice as many lanes.
+	 *
+	 */
+	struct avx2 {
+		static inline bool supported() noexcept {
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+		}
+
+		__attribute__((target("avx2,popcnt")))
+		static size_t count_less(const uint8_t* keys, size_t size, uint8_t key) noexcept {
+			const __m256i bias = _mm256_set1_epi8(static_cast<char>(0x80));
+			const __m256i pivot = _mm256_xor_si256(_mm256_set1_epi8(static_cast<char>(key)), bias);
+			size_t count = 0, i = 0;
+			for (; i + 32 <= size; i += 32) {
+				auto lanes = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), bias);
+				count += _mm_popcnt_u32(_mm256_movemask_epi8(_mm256_cmpgt_epi8(pivot, lanes)));
+			}
+			return count + sse42::count_less(keys + i, size - i, key);
+		}
+
+		__attribute__((target("avx2,popcnt")))
+		static size_t count_less(const uint16_t* keys, size_t size, uint16_t key) noexcept {
+			const __m256i bias = _mm256_set1_epi16(static_cast<short>(0x8000));
+			const __m256i pivot = _mm256_xor_si256(_mm256_set1_epi16(static_cast<short>(key)), bias);
+			size_t count = 0, i = 0;
+			for (; i + 16 <= size; i += 16) {
+				auto lanes = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), bias);
+				count += _mm_popcnt_u32(_mm256_movemask_epi8(_mm256_cmpgt_epi16(pivot, lanes))) >> 1;
+			}
+			return count + sse42::count_less(keys + i, size - i, key);
+		}
+
+		__attribute__((target("avx2,popcnt")))
+		static size_t count_less(const uint32_t* keys, size_t size, uint32_t key) noexcept {
+			const __m256i bias = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+			const __m256i pivot = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int>(key)), bias);
+			size_t count = 0, i = 0;
+			for (; i + 8 <= size; i += 8) {
+				auto lanes = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), bias);
+				count += _mm_popcnt_u32(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivot, lanes))));
+			}
+			return count + sse42::count_less(keys + i, size - i, key);
+		}
+
+		__attribute__((target("avx2,popcnt")))
+		static size_t count_less(const uint64_t* keys, size_t size, uint64_t key) noexcept {
+			const __m256i bias = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+			const __m256i pivot = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(key)), bias);
+			size_t count = 0, i = 0;
+			for (; i + 4 <= size; i += 4) {
+				auto lanes = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i)), bias);
+				count += _mm_popcnt_u32(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(pivot, lanes))));
+			}
+			return count + sse42::count_less(keys + i, size - i, key);
+		}
+	};
+
+	/**
+	 * @brief AVX-512 kernels. These compare unsigned lanes directly into a mask register, and
+	 * masked loads handle the tail of the array without a scalar loop.
+	 *
+	 */
+	struct avx512 {
+		static inline bool supported() noexcept {
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+			       __builtin_cpu_supports("popcnt");
+		}
+
+		__attribute__((target("avx512f,avx512bw,popcnt")))
+		static size_t count_less(const uint8_t* keys, size_t size, uint8_t key) noexcept {
+			const __m512i pivot = _mm512_set1_epi8(static_cast<char>(key));
+			size_t count = 0;
+			for (size_t i = 0; i < size; i += 64) {
+				__mmask64 valid = size - i >= 64 ? ~0ull : (1ull << (size - i)) - 1;
+				auto lanes = _mm512_maskz_loadu_epi8(valid, keys + i);
+				count += _mm_popcnt_u64(_mm512_mask_cmplt_epu8_mask(valid, lanes, pivot));
+			}
+			return count;
+		}
+
+		__attribute__((target("avx512f,avx512bw,popcnt")))
+		static size_t count_less(const uint16_t* keys, size_t size, uint16_t key) noexcept {
+			const __m512i pivot = _mm512_set1_epi16(static_cast<short>(key));
+			size_t count = 0;
+			for (size_t i = 0; i < size; i += 32) {
+				__mmask32 valid = size - i >= 32 ? ~0u : (1u << (size - i)) - 1;
+				auto lanes = _mm512_maskz_loadu_epi16(valid, keys + i);
+				count += _mm_popcnt_u32(_mm512_mask_cmplt_epu16_mask(valid, lanes, pivot));
+			}
+			return count;
+		}
+
+		__attribute__((target("avx512f,avx512bw,popcnt")))
+		static size_t count_less(const uint32_t* keys, size_t size, uint32_t key) noexcept {
+			const __m512i pivot = _mm512_set1_epi32(static_cast<int>(key));
+			size_t count = 0;
+			for (size_t i = 0; i < size; i += 16) {
+				__mmask16 valid = size - i >= 16 ? 0xFFFF : (1u << (size - i)) - 1;
+				auto lanes = _mm512_maskz_loadu_epi32(valid, keys + i);
+				count += _mm_popcnt_u32(_mm512_mask_cmplt_epu32_mask(valid, lanes, pivot));
+			}
+			return count;
+		}
+
+		__attribute__((target("avx512f,avx512bw,popcnt")))
+		static size_t count_less(const uint64_t* keys, size_t size, uint64_t key) noexcept {
+			const __m512i pivot = _mm512_set1_epi64(static_cast<long long>(key));
+			size_t count = 0;
+			for (size_t i = 0; i < size; i += 8) {
+				__mmask8 valid = size - i >= 8 ? 0xFF : (1u << (size - i)) - 1;
+				auto lanes = _mm512_maskz_loadu_epi64(valid, keys + i);
+				count += _mm_popcnt_u32(_mm512_mask_cmplt_epu64_mask(valid, lanes, pivot));
+			}
+			return count;
+		}
+	};
+
+#endif
+
+	/**
+	 * @brief Select the widest kernel supported by the current CPU.
+	 *
+	 * @return the selected kernel.
+	 */
+	template <typename Key_>
+	count_less_fn<Key_> select_count_less() noexcept {
+#if SORTED_ARRAY_BUCKET_X86
+		if (avx512::supported()) return &avx512::count_less;
+		if (avx2::supported()) return &avx2::count_less;
+		if (sse42::supported()) return &sse42::count_less;
+#endif
+		return &scalar::count_less<Key_>;
+	}
+
+	/**
+	 * @brief Count the keys strictly less than a given key with the kernel selected on first use.
+	 * The selection is a function local static so that it is safe to use during static
+	 * initialization.
+	 *
+	 * @param keys is a sorted array.
+	 * @param size is the number of keys in the array.
+	 * @param key to rank.
+	 * @return the number of keys less than the key.
+	 */
+	template <typename Key_>
+	inline size_t count_less(const Key_* keys, size_t size, Key_ key) noexcept {
+		static const count_less_fn<Key_> kernel = select_count_less<Key_>();
+		return kernel(keys, size, key);
+	}
+}
+
+/**
+ * @brief Search policy that narrows the range with a branchless binary search until it spans two
+ * cache lines and then ranks the key within the range using the widest SIMD kernel that the CPU
+ * supports. Kernels exist for uint8_t, uint16_t, uint32_t and uint64_t keys.
+ *
+ */
+struct SimdSearch {
+	/**
+	 * @brief Count the keys strictly less than a given key.
+	 *
+	 * @param keys is a sorted array.
+	 * @param size is the number of keys in the array.
+	 * @param key to rank.
+	 * @return the number of keys less than the key.
+	 */
+	template <typename Key_>
+	static inline size_t rank(const Key_* keys, size_t size, Key_ key) noexcept {
+		constexpr size_t block = 128 / sizeof(Key_);
+
+		// Every key before base is less than the key and every key from base + n onwards is
+		// greater than or equal to the key, so only the block in between needs to be counted.
+		const Key_* base = keys;
+		size_t n = size;
+		while (n > block) {
+			size_t half = n >> 1;
+			base = (base[half] < key) ? base + half : base;
+			n -= half;
+		}
+		return (base - keys) + sorted_array_bucket_kernels::count_less(base, n, key);
+	}
+};
@@ -0,0 +1,362 @@
+/**
+ * @file sorted-array-bucket.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief SortedArrayBucket class template.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ */
+
+#pragma once
+#include "../constants.h"
+#include "sorted-array-bucket-search.h"
+#include <optional>
+#include <array>
+#include <limits>
+#include <algorithm>
+#include <assert.h>
+#include <type_traits>
+
+/**
+ * @brief Small ordered set that stores its keys in a sorted inline array.
+ *
+ * Searches are delegated to a search policy and split and merge are plain copies, so every
+ * operation touches a few contiguous cache lines. YFastTrie partitions grow to at most 5/2 times
+ * the bit length of the keys before they are split, which is the default capacity.
+ *
+ * A search policy provides a static function template
+ * `size_t rank(const Key_* keys, size_t size, Key_ key)` that returns the number of keys in the
+ * sorted array that are strictly less than the key. See sorted-array-bucket-search.h.
+ *
+ * @tparam Key_ is the key type.
+ * @tparam Capacity_ is the maximum number of keys.
+ * @tparam Search_ is the search policy.
+ */
+template <typename Key_, size_t Capacity_ = std::numeric_limits<Key_>::digits * 5 / 2,
+          typename Search_ = BranchlessSearch>
+class alignas(64) SortedArrayBucket {
+public:
+	using key_type = Key_;
+	static_assert(std::is_unsigned<key_type>::value, "Key type must be an unsigned integer.");
+
+	using some_key_type = std::optional<key_type>;
+	using size_type = size_t;
+
+	// The keys are stored contiguously, so a pointer is a bidirectional iterator over them.
+	using const_iterator = const key_type*;
+
+private:
+	using bucket_type = SortedArrayBucket<key_type, Capacity_, Search_>;
+	using bucket_ptr = bucket_type*;
+	using keys_type = std::array<key_type, Capacity_>;
+
+private:
+	size_type size_;
+	keys_type keys_;
+
+private:
+	// The maximum number of keys.
+	static constexpr size_type capacity_ = Capacity_;
+
+	// The maximum key value.
+	static constexpr key_type upper_bound_ = std::numeric_limits<key_type>::max();
+
+	// The minimum key value.
+	static constexpr key_type lower_bound_ = std::numeric_limits<key_type>::min();
+
+	static_assert(capacity_ > 1, "Capacity must be at least 2.");
+
+public:
+	/**
+	 * @brief Find the maximum possible key.
+	 *
+	 * @return key_type maximum possible key.
+	 */
+	static constexpr key_type upper_bound() noexcept {
+		return upper_bound_;
+	}
+
+	/**
+	 * @brief Find the minimum possible key.
+	 *
+	 * @return key_type mimimum possible key.
+	 */
+	static constexpr key_type lower_bound() noexcept {
+		return lower_bound_;
+	}
+
+	/**
+	 * @brief Get the maximum number of keys.
+	 *
+	 * @return the maximum number of keys.
+	 */
+	static constexpr size_type capacity() noexcept {
+		return capacity_;
+	}
+
+public:
+	/**
+	 * @brief Construct a new SortedArrayBucket object.
+	 *
+	 */
+	SortedArrayBucket() : size_(0) {  }
+
+	/**
+	 * @brief Construct a new SortedArrayBucket object from a range of strictly increasing keys.
+	 *
+	 * @param first key of the range.
+	 * @param last key of the range, exclusive.
+	 */
+	template <typename Iterator_>
+	SortedArrayBucket(Iterator_ first, Iterator_ last) : size_(0) {
+		for (; first != last; ++first) {
+			assert(size_ < capacity_ && "The range exceeds the capacity.");
+			assert((size_ == 0 || keys_[size_ - 1] < *first) && "Keys must be strictly increasing.");
+			keys_[size_++] = *first;
+		}
+	}
+
+	/**
+	 * @brief Get the number of keys stored in the bucket.
+	 *
+	 * @return size_type number of keys stored in the bucket.
+	 */
+	inline size_type size() const noexcept {
+		return size_;
+	}
+
+	/**
+	 * @brief Check if the bucket is empty.
+	 *
+	 * @return true if the bucket contains no keys.
+	 * @return false if the bucket contains some keys.
+	 */
+	inline bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	/**
+	 * @brief Get the number of bytes that the bucket allocates outside of itself for each key.
+	 * The keys are stored inline, so this is 0.
+	 *
+	 * @return size_type number of bytes per key outside of the bucket.
+	 */
+	static constexpr size_type memory_per_key() noexcept {
+		return 0;
+	}
+
+	/**
+	 * @brief Count the keys strictly less than a given key.
+	 *
+	 * @param key to rank.
+	 * @return the number of keys less than the key, which is also the index of the first key
+	 * that is greater than or equal to the key.
+	 */
+	inline size_type rank(key_type key) const noexcept {
+		return Search_::rank(keys_.data(), size_, key);
+	}
+
+	/**
+	 * @brief Find the key with a given index in increasing order.
+	 *
+	 * @param index of the key, starting from 0.
+	 * @return some_key_type key if the index is less than the size of the bucket.
+	 * @return none_key_type if the index is out of range.
+	 */
+	inline some_key_type select(size_type index) const noexcept {
+		if (index >= size_) return some_key_type();
+		return some_key_type(keys_[index]);
+	}
+
+	/**
+	 * @brief Check if the bucket contains a key.
+	 *
+	 * @param key to check if the bucket contains.
+	 * @return true if the bucket contains the key.
+	 * @return false if the bucket does not contain the key.
+	 */
+	inline bool contains(key_type key) const noexcept {
+		auto index = rank(key);
+		return index < size_ && keys_[index] == key;
+	}
+
+	/**
+	 * @brief Find the predecessor of a key.
+	 *
+	 * @param key to find the predecessor of.
+	 * @return some_key_type predecessor key if the predecessor exists.
+	 * @return none_key_type if the predecessor does not exist.
+	 */
+	inline some_key_type predecessor(key_type key) const noexcept {
+		auto index = rank(key);
+		if (index == 0) return some_key_type();
+		return some_key_type(keys_[index - 1]);
+	}
+
+	/**
+	 * @brief Find the successor of a key.
+	 *
+	 * @param key to find the successor of.
+	 * @return some_key_type successor key if the successor exists.
+	 * @return none_key_type if the successor does not exist.
+	 */
+	inline some_key_type successor(key_type key) const noexcept {
+		auto index = rank(key);
+		index += (index < size_ && keys_[index] == key);
+		if (index == size_) return some_key_type();
+		return some_key_type(keys_[index]);
+	}
+
+	/**
+	 * @brief Find the minimum key.
+	 *
+	 * @return some_key_type minimum key if the bucket is not empty.
+	 * @return none_key_type if the bucket is empty.
+	 */
+	inline some_key_type min() const noexcept {
+		if (empty()) return some_key_type();
+		return some_key_type(keys_[0]);
+	}
+
+	/**
+	 * @brief Find the maximum key.
+	 *
+	 * @return some_key_type maximum key if the bucket is not empty.
+	 * @return none_key_type if the bucket is empty.
+	 */
+	inline some_key_type max() const noexcept {
+		if (empty()) return some_key_type();
+		return some_key_type(keys_[size_ - 1]);
+	}
+
+	/**
+	 * @brief Get an iterator to the minimum key.
+	 *
+	 * @return iterator to the minimum key, or the end if the bucket is empty.
+	 */
+	inline const_iterator begin() const noexcept {
+		return keys_.data();
+	}
+
+	/**
+	 * @brief Get an iterator past the maximum key.
+	 *
+	 * @return iterator past the maximum key.
+	 */
+	inline const_iterator end() const noexcept {
+		return keys_.data() + size_;
+	}
+
+	/**
+	 * @brief Get an iterator to the smallest key that is greater than or equal to a key.
+	 *
+	 * @param key to search for.
+	 * @return iterator to the key, or the end if no such key exists.
+	 */
+	inline const_iterator lower_bound(key_type key) const noexcept {
+		return keys_.data() + rank(key);
+	}
+
+	/**
+	 * @brief Insert a key into the bucket.
+	 *
+	 * @param key to insert into the bucket.
+	 */
+	void insert(key_type key) noexcept(NEX) {
+		auto index = rank(key);
+
+		// Prevent double insertions.
+		if (index < size_ && keys_[index] == key) return;
+
+		assert(size_ < capacity_ && "Cannot insert into a full bucket.");
+		std::copy_backward(keys_.begin() + index, keys_.begin() + size_, keys_.begin() + size_ + 1);
+		keys_[index] = key;
+		size_ += 1;
+	}
+
+	/**
+	 * @brief Remove a key from the bucket.
+	 *
+	 * @param key to remove from the bucket.
+	 */
+	void remove(key_type key) noexcept(NEX) {
+		auto index = rank(key);
+
+		// Prevent double removes.
+		if (index == size_ || keys_[index] != key) return;
+
+		std::copy(keys_.begin() + index + 1, keys_.begin() + size_, keys_.begin() + index);
+		size_ -= 1;
+	}
+
+	/**
+	 * @brief Split the current bucket into two new buckets.
+	 *
+	 * @return left bucket with values less than the median and a right bucket with all other values.
+	 */
+	std::array<bucket_ptr, 2> split() noexcept(NEX) {
+		assert(size_ > 1 && "Cannot split a bucket with size 0 or 1");
+
+		auto mid = size_ / 2;
+		auto left_bucket = new bucket_type();
+		auto right_bucket = new bucket_type();
+
+		std::copy(keys_.begin(), keys_.begin() + mid, left_bucket->keys_.begin());
+		left_bucket->size_ = mid;
+
+		std::copy(keys_.begin() + mid, keys_.begin() + size_, right_bucket->keys_.begin());
+		right_bucket->size_ = size_ - mid;
+
+		// Ensure that the current bucket does not have any associated data.
+		size_ = 0;
+
+		return std::array<bucket_ptr, 2>{left_bucket, right_bucket};
+	}
+
+	/**
+	 * @brief Build a new bucket from a range of strictly increasing keys.
+	 *
+	 * @param first key of the range.
+	 * @param last key of the range, exclusive.
+	 * @return the new bucket.
+	 */
+	template <typename Iterator_>
+	bucket_ptr build(Iterator_ first, Iterator_ last) noexcept(NEX) {
+		return new bucket_type(first, last);
+	}
+
+	/**
+	 * @brief Merge two buckets into a single bucket.
+	 *
+	 * @param left_bucket with values strictly less than the right bucket.
+	 * @param right_bucket with values strictly greater than the left bucket.
+	 * @return the merged bucket.
+	 */
+	bucket_ptr merge(bucket_ptr left_bucket, bucket_ptr right_bucket) noexcept(NEX) {
+		assert(!left_bucket->empty() && !right_bucket->empty() && "Cannot merge empty buckets.");
+		assert(left_bucket->max().value() < right_bucket->min().value() &&
+		       "The left bucket must contain values strictly less than the right bucket.");
+		assert(left_bucket->size_ + right_bucket->size_ <= capacity_ &&
+		       "The merged bucket exceeds the capacity.");
+
+		auto merged_bucket = new bucket_type();
+		auto middle = std::copy(left_bucket->keys_.begin(), left_bucket->keys_.begin() + left_bucket->size_,
+		                        merged_bucket->keys_.begin());
+		std::copy(right_bucket->keys_.begin(), right_bucket->keys_.begin() + right_bucket->size_, middle);
+		merged_bucket->size_ = left_bucket->size_ + right_bucket->size_;
+
+		// Ensure that the original buckets do not have any associated data.
+		left_bucket->size_ = 0;
+		right_bucket->size_ = 0;
+
+		return merged_bucket;
+	}
+};
+
+/**
+ * @brief SortedArrayBucket that ranks keys with SIMD kernels selected at runtime.
+ *
+ * @tparam Key_ is the key type.
+ */
+template <typename Key_>
+using SimdSortedArrayBucket = SortedArrayBucket<Key_, std::numeric_limits<Key_>::digits * 5 / 2, SimdSearch>;
@@ -0,0 +1,376 @@
+/**
+ * @file sorted-array-map-bucket.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief SortedArrayMapBucket class template.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "../constants.h"
+#include "sorted-array-bucket-search.h"
+#include <optional>
+#include <array>
+#include <limits>
+#include <new>
+#include <utility>
+#include <assert.h>
+#include <type_traits>
+
+/**
+ * @brief Small ordered map that stores its keys in a sorted inline array and each value inline in
+ * a parallel array.
+ *
+ * The keys are searched exactly like the keys of SortedArrayBucket, so the values are only
+ * touched once the index of a key is known. Values are constructed in place and only ever moved,
+ * never copied, so move-only value types are supported. Besides the bucket operations that
+ * YFastTrie needs, a value can be passed to insert, and find and the entry queries return
+ * pointers to the stored values.
+ *
+ * @tparam Key_ is the key type.
+ * @tparam Value_ is the value type.
+ * @tparam Capacity_ is the maximum number of entries.
+ * @tparam Search_ is the search policy. See sorted-array-bucket-search.h.
+ */
+template <typename Key_, typename Value_, size_t Capacity_ = std::numeric_limits<Key_>::digits * 5 / 2,
+          typename Search_ = BranchlessSearch>
+class alignas(64) SortedArrayMapBucket {
+public:
+	using key_type = Key_;
+	static_assert(std::is_unsigned<key_type>::value, "Key type must be an unsigned integer.");
+
+	using value_type = Value_;
+	using some_key_type = std::optional<key_type>;
+	using size_type = size_t;
+
+	// An entry pairs a key with a pointer to its value, which stays valid until the bucket is
+	// changed.
+	using entry_type = std::pair<key_type, value_type*>;
+	using const_entry_type = std::pair<key_type, const value_type*>;
+	using some_entry_type = std::optional<entry_type>;
+	using some_const_entry_type = std::optional<const_entry_type>;
+
+private:
+	using bucket_type = SortedArrayMapBucket<key_type, value_type, Capacity_, Search_>;
+	using bucket_ptr = bucket_type*;
+	using keys_type = std::array<key_type, Capacity_>;
+
+	/**
+	 * @brief Storage for a value that is only constructed while its slot is in use.
+	 *
+	 */
+	union slot_type {
+		value_type value;
+		slot_type() noexcept {  }
+		~slot_type() {  }
+	};
+
+	using slots_type = std::array<slot_type, Capacity_>;
+
+private:
+	size_type size_;
+	keys_type keys_;
+	slots_type slots_;
+
+private:
+	// The maximum number of entries.
+	static constexpr size_type capacity_ = Capacity_;
+
+	static_assert(capacity_ > 1, "Capacity must be at least 2.");
+
+private:
+	/**
+	 * @brief Move the value of one slot into another, unused slot and destroy the original.
+	 *
+	 * @param from is the slot to move from.
+	 * @param to is the unused slot to move to.
+	 */
+	static inline void relocate(slot_type& from, slot_type& to) noexcept(NEX) {
+		new (&to.value) value_type(std::move(from.value));
+		from.value.~value_type();
+	}
+
+	/**
+	 * @brief Move the entries of the bucket into the end of another bucket. The current bucket is
+	 * left empty.
+	 *
+	 * @param first index of the entries to move.
+	 * @param last index of the entries to move, exclusive.
+	 * @param bucket to append the entries to.
+	 */
+	void relocate_to(size_type first, size_type last, bucket_ptr bucket) noexcept(NEX) {
+		for (auto index = first; index < last; ++index) {
+			assert(bucket->size_ < capacity_ && "The entries exceed the capacity.");
+			bucket->keys_[bucket->size_] = keys_[index];
+			relocate(slots_[index], bucket->slots_[bucket->size_]);
+			bucket->size_ += 1;
+		}
+	}
+
+	/**
+	 * @brief Get the index of a key.
+	 *
+	 * @param key to find.
+	 * @return the index of the key or the size of the bucket if the bucket does not contain it.
+	 */
+	inline size_type index_of(key_type key) const noexcept {
+		auto index = rank(key);
+		return index < size_ && keys_[index] == key ? index : size_;
+	}
+
+public:
+	/**
+	 * @brief Construct a new SortedArrayMapBucket object.
+	 *
+	 */
+	SortedArrayMapBucket() : size_(0) {  }
+
+	SortedArrayMapBucket(const SortedArrayMapBucket&) = delete;
+	SortedArrayMapBucket& operator=(const SortedArrayMapBucket&) = delete;
+
+	/**
+	 * @brief Get the number of entries stored in the bucket.
+	 *
+	 * @return size_type number of entries stored in the bucket.
+	 */
+	inline size_type size() const noexcept {
+		return size_;
+	}
+
+	/**
+	 * @brief Check if the bucket is empty.
+	 *
+	 * @return true if the bucket contains no entries.
+	 * @return false if the bucket contains some entries.
+	 */
+	inline bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	/**
+	 * @brief Get the number of bytes that the bucket allocates outside of itself for each key.
+	 * The entries are stored inline, so this is 0.
+	 *
+	 * @return size_type number of bytes per key outside of the bucket.
+	 */
+	static constexpr size_type memory_per_key() noexcept {
+		return 0;
+	}
+
+	/**
+	 * @brief Count the keys strictly less than a given key.
+	 *
+	 * @param key to rank.
+	 * @return the number of keys less than the key.
+	 */
+	inline size_type rank(key_type key) const noexcept {
+		return Search_::rank(keys_.data(), size_, key);
+	}
+
+	/**
+	 * @brief Check if the bucket contains a key.
+	 *
+	 * @param key to check if the bucket contains.
+	 * @return true if the bucket contains the key.
+	 * @return false if the bucket does not contain the key.
+	 */
+	inline bool contains(key_type key) const noexcept {
+		return index_of(key) != size_;
+	}
+
+	/**
+	 * @brief Find the value of a key.
+	 *
+	 * @param key to find the value of.
+	 * @return pointer to the value or nullptr if the bucket does not contain the key.
+	 */
+	inline value_type* find(key_type key) noexcept {
+		auto index = index_of(key);
+		return index == size_ ? nullptr : &slots_[index].value;
+	}
+
+	/**
+	 * @brief Find the value of a key.
+	 *
+	 * @param key to find the value of.
+	 * @return pointer to the value or nullptr if the bucket does not contain the key.
+	 */
+	inline const value_type* find(key_type key) const noexcept {
+		auto index = index_of(key);
+		return index == size_ ? nullptr : &slots_[index].value;
+	}
+
+	/**
+	 * @brief Find the predecessor of a key.
+	 *
+	 * @param key to find the predecessor of.
+	 * @return some_key_type predecessor key if the predecessor exists.
+	 * @return none_key_type if the predecessor does not exist.
+	 */
+	inline some_key_type predecessor(key_type key) const noexcept {
+		auto index = rank(key);
+		if (index == 0) return some_key_type();
+		return some_key_type(keys_[index - 1]);
+	}
+
+	/**
+	 * @brief Find the successor of a key.
+	 *
+	 * @param key to find the successor of.
+	 * @return some_key_type successor key if the successor exists.
+	 * @return none_key_type if the successor does not exist.
+	 */
+	inline some_key_type successor(key_type key) const noexcept {
+		auto index = rank(key);
+		index += (index < size_ && keys_[index] == key);
+		if (index == size_) return some_key_type();
+		return some_key_type(keys_[index]);
+	}
+
+	/**
+	 * @brief Find the entry of the predecessor of a key.
+	 *
+	 * @param key to find the predecessor of.
+	 * @return some_entry_type predecessor entry if the predecessor exists.
+	 * @return none_entry_type if the predecessor does not exist.
+	 */
+	inline some_entry_type predecessor_entry(key_type key) noexcept {
+		auto index = rank(key);
+		if (index == 0) return some_entry_type();
+		return some_entry_type(entry_type(keys_[index - 1], &slots_[index - 1].value));
+	}
+
+	/**
+	 * @brief Find the entry of the successor of a key.
+	 *
+	 * @param key to find the successor of.
+	 * @return some_entry_type successor entry if the successor exists.
+	 * @return none_entry_type if the successor does not exist.
+	 */
+	inline some_entry_type successor_entry(key_type key) noexcept {
+		auto index = rank(key);
+		index += (index < size_ && keys_[index] == key);
+		if (index == size_) return some_entry_type();
+		return some_entry_type(entry_type(keys_[index], &slots_[index].value));
+	}
+
+	/**
+	 * @brief Find the minimum key.
+	 *
+	 * @return some_key_type minimum key if the bucket is not empty.
+	 * @return none_key_type if the bucket is empty.
+	 */
+	inline some_key_type min() const noexcept {
+		if (empty()) return some_key_type();
+		return some_key_type(keys_[0]);
+	}
+
+	/**
+	 * @brief Find the maximum key.
+	 *
+	 * @return some_key_type maximum key if the bucket is not empty.
+	 * @return none_key_type if the bucket is empty.
+	 */
+	inline some_key_type max() const noexcept {
+		if (empty()) return some_key_type();
+		return some_key_type(keys_[size_ - 1]);
+	}
+
+	/**
+	 * @brief Insert an entry into the bucket, constructing the value in place. Nothing happens if
+	 * the bucket already contains the key.
+	 *
+	 * @param key to insert into the bucket.
+	 * @param args to forward to the value constructor.
+	 */
+	template <typename... Args>
+	void insert(key_type key, Args&&... args) noexcept(NEX) {
+		auto index = rank(key);
+
+		// Prevent double insertions.
+		if (index < size_ && keys_[index] == key) return;
+
+		assert(size_ < capacity_ && "Cannot insert into a full bucket.");
+		for (auto slot = size_; slot > index; --slot) {
+			keys_[slot] = keys_[slot - 1];
+			relocate(slots_[slot - 1], slots_[slot]);
+		}
+		keys_[index] = key;
+		new (&slots_[index].value) value_type(std::forward<Args>(args)...);
+		size_ += 1;
+	}
+
+	/**
+	 * @brief Remove an entry from the bucket and destroy its value.
+	 *
+	 * @param key to remove from the bucket.
+	 */
+	void remove(key_type key) noexcept(NEX) {
+		auto index = index_of(key);
+
+		// Prevent double removes.
+		if (index == size_) return;
+
+		slots_[index].value.~value_type();
+		for (auto slot = index + 1; slot < size_; ++slot) {
+			keys_[slot - 1] = keys_[slot];
+			relocate(slots_[slot], slots_[slot - 1]);
+		}
+		size_ -= 1;
+	}
+
+	/**
+	 * @brief Split the current bucket into two new buckets. The values are moved and the current
+	 * bucket is left empty.
+	 *
+	 * @return left bucket with keys less than the median and a right bucket with all other keys.
+	 */
+	std::array<bucket_ptr, 2> split() noexcept(NEX) {
+		assert(size_ > 1 && "Cannot split a bucket with size 0 or 1");
+
+		auto mid = size_ / 2;
+		auto left_bucket = new bucket_type();
+		auto right_bucket = new bucket_type();
+		relocate_to(0, mid, left_bucket);
+		relocate_to(mid, size_, right_bucket);
+
+		// Ensure that the current bucket does not have any associated data.
+		size_ = 0;
+
+		return std::array<bucket_ptr, 2>{left_bucket, right_bucket};
+	}
+
+	/**
+	 * @brief Merge two buckets into a single bucket. The values are moved and the original
+	 * buckets are left empty.
+	 *
+	 * @param left_bucket with keys strictly less than the right bucket.
+	 * @param right_bucket with keys strictly greater than the left bucket.
+	 * @return the merged bucket.
+	 */
+	bucket_ptr merge(bucket_ptr left_bucket, bucket_ptr right_bucket) noexcept(NEX) {
+		assert(!left_bucket->empty() && !right_bucket->empty() && "Cannot merge empty buckets.");
+		assert(left_bucket->max().value() < right_bucket->min().value() &&
+		       "The left bucket must contain keys strictly less than the right bucket.");
+
+		auto merged_bucket = new bucket_type();
+		left_bucket->relocate_to(0, left_bucket->size_, merged_bucket);
+		right_bucket->relocate_to(0, right_bucket->size_, merged_bucket);
+
+		// Ensure that the original buckets do not have any associated data.
+		left_bucket->size_ = 0;
+		right_bucket->size_ = 0;
+
+		return merged_bucket;
+	}
+
+	/**
+	 * @brief Destroy the SortedArrayMapBucket object and the values that it stores.
+	 *
+	 */
+	~SortedArrayMapBucket() {
+		for (size_type index = 0; index < size_; ++index)
+			slots_[index].value.~value_type();
+	}
+};
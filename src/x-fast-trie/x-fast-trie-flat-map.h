@@ -0,0 +1,336 @@
+/**
+ * @file x-fast-trie-flat-map.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Open addressing hash table for the level search structures.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ */
+
+#pragma once
+#include "../constants.h"
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+#include <assert.h>
+#include <type_traits>
+
+/**
+ * @brief Open addressing hash table with linear probing.
+ *
+ * Entries are stored inline in a single power of two sized array, so a probe touches one cache
+ * line instead of chasing a bucket list. Removals shift the rest of the probe sequence backwards,
+ * so the table never contains tombstones.
+ *
+ * @tparam Key_ is the key type.
+ * @tparam Value_ is the value type.
+ */
+template <typename Key_, typename Value_>
+class flat_map {
+public:
+	using key_type = Key_;
+	using value_type = Value_;
+	using size_type = size_t;
+	static_assert(std::is_unsigned<key_type>::value, "Key type must be an unsigned integer.");
+
+private:
+	/**
+	 * @brief Slot in the table. The members are named like std::pair so that range based for
+	 * loops read the same as they do over std::unordered_map.
+	 *
+	 */
+	struct slot_type {
+		key_type first;
+		bool used;
+		value_type second;
+	};
+
+	using slots_type = std::vector<slot_type>;
+
+private:
+	// Number of slots allocated on the first insertion.
+	static constexpr size_type initial_capacity_ = 16;
+
+	// Largest power of two that fits in a size_type.
+	static constexpr size_type largest_capacity_ =
+		static_cast<size_type>(1) << (std::numeric_limits<size_type>::digits - 1);
+
+	// Fibonacci hashing multiplier.
+	static constexpr uint64_t multiplier_ = 0x9E3779B97F4A7C15ull;
+
+private:
+	slots_type slots_;
+	size_type size_;
+	size_type mask_;
+	size_type shift_;
+	size_type max_capacity_;
+
+private:
+	/**
+	 * @brief Compute the smallest capacity that holds a number of keys at a load factor of 1/2.
+	 *
+	 * @param size is the number of keys.
+	 * @return the capacity.
+	 */
+	static constexpr size_type capacity_for(size_type size) noexcept {
+		if (size >= largest_capacity_ / 2) return largest_capacity_;
+		size_type capacity = 2;
+		while (capacity < 2 * size) capacity <<= 1;
+		return capacity;
+	}
+
+	/**
+	 * @brief Get the home slot of a key.
+	 *
+	 * @param key to hash.
+	 * @return index of the home slot.
+	 */
+	inline size_type home(key_type key) const noexcept {
+		return static_cast<size_type>((static_cast<uint64_t>(key) * multiplier_) >> shift_);
+	}
+
+	/**
+	 * @brief Get the slot that contains a key or the empty slot that ends its probe sequence.
+	 *
+	 * @param key to find.
+	 * @return index of the slot.
+	 */
+	inline size_type find_index(key_type key) const noexcept {
+		auto index = home(key);
+		while (slots_[index].used && slots_[index].first != key)
+			index = (index + 1) & mask_;
+		return index;
+	}
+
+	/**
+	 * @brief Reallocate the table with a new capacity and reinsert every entry.
+	 *
+	 * @param capacity is the new capacity. Must be a power of two.
+	 */
+	void rehash(size_type capacity) noexcept(NEX) {
+		assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+		slots_type old_slots(capacity);
+		old_slots.swap(slots_);
+
+		mask_ = capacity - 1;
+		shift_ = 64;
+		while (capacity > 1) {
+			capacity >>= 1;
+			--shift_;
+		}
+
+		for (auto& slot : old_slots) {
+			if (!slot.used) continue;
+			slots_[find_index(slot.first)] = slot;
+		}
+	}
+
+	/**
+	 * @brief Grow the table if inserting another key would exceed a load factor of 1/2.
+	 *
+	 */
+	inline void grow_if_needed() noexcept(NEX) {
+		if (slots_.empty())
+			rehash(std::min(initial_capacity_, max_capacity_));
+		else if (2 * (size_ + 1) > slots_.size() && slots_.size() < max_capacity_)
+			rehash(slots_.size() << 1);
+	}
+
+public:
+	/**
+	 * @brief Iterator over the entries in the table.
+	 *
+	 */
+	class const_iterator {
+	private:
+		const slot_type* slot_;
+		const slot_type* end_;
+
+		inline void skip_unused() noexcept {
+			while (slot_ != end_ && !slot_->used) ++slot_;
+		}
+
+	public:
+		const_iterator(const slot_type* slot, const slot_type* end) : slot_(slot), end_(end) {
+			skip_unused();
+		}
+
+		inline const slot_type& operator*() const noexcept { return *slot_; }
+		inline const slot_type* operator->() const noexcept { return slot_; }
+
+		inline const_iterator& operator++() noexcept {
+			++slot_;
+			skip_unused();
+			return *this;
+		}
+
+		inline bool operator==(const const_iterator& other) const noexcept { return slot_ == other.slot_; }
+		inline bool operator!=(const const_iterator& other) const noexcept { return slot_ != other.slot_; }
+	};
+
+public:
+	/**
+	 * @brief Construct a new flat_map object.
+	 *
+	 * @param max_size is an upper bound on the number of keys the table will ever hold. Tables
+	 * with a small bound are allocated at their final capacity and never rehash.
+	 */
+	flat_map(size_type max_size = std::numeric_limits<size_type>::max())
+		: size_(0), mask_(0), shift_(0), max_capacity_(capacity_for(max_size)) {  }
+
+	/**
+	 * @brief Get the number of keys in the hash table.
+	 *
+	 * @return number of keys in the hash table.
+	 */
+	inline size_type size() const noexcept {
+		return size_;
+	}
+
+	/**
+	 * @brief Check if the hash table is empty.
+	 *
+	 * @return true if the hash table contains no keys.
+	 * @return false if the hash table contains some keys.
+	 */
+	inline bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	/**
+	 * @brief Get the number of bytes allocated for the slots, whether they are used or not.
+	 *
+	 * @return number of bytes allocated by the hash table.
+	 */
+	inline size_type memory_usage() const noexcept {
+		return slots_.capacity() * sizeof(slot_type);
+	}
+
+	/**
+	 * @brief Check if a key is in the hash table.
+	 *
+	 * @param key to check.
+	 * @return true if the key is in the hash table.
+	 * @return false if the key is not in the hash table.
+	 */
+	inline bool contains(key_type key) const noexcept {
+		if (empty()) return false;
+		return slots_[find_index(key)].used;
+	}
+
+	/**
+	 * @brief Prefetch the home slot of a key, so that a later lookup of the key is less likely to
+	 * miss the cache.
+	 *
+	 * @param key to prefetch.
+	 */
+	inline void prefetch(key_type key) const noexcept {
+		if (!slots_.empty())
+			__builtin_prefetch(&slots_[home(key)]);
+	}
+
+	/**
+	 * @brief Get the value of a key. The key must be in the hash table.
+	 *
+	 * @param key to get the value of.
+	 * @return the value of the key.
+	 */
+	inline const value_type& at(key_type key) const noexcept(NEX) {
+		assert(contains(key));
+		return slots_[find_index(key)].second;
+	}
+
+	/**
+	 * @brief Get the value of a key. The key must be in the hash table.
+	 *
+	 * @param key to get the value of.
+	 * @return the value of the key.
+	 */
+	inline value_type& at(key_type key) noexcept(NEX) {
+		assert(contains(key));
+		return slots_[find_index(key)].second;
+	}
+
+	/**
+	 * @brief Get the value of a key, inserting a default value if the key is not present.
+	 *
+	 * @param key to get the value of.
+	 * @return the value of the key.
+	 */
+	value_type& operator[](key_type key) noexcept(NEX) {
+		grow_if_needed();
+		auto& slot = slots_[find_index(key)];
+		if (!slot.used) {
+			slot.first = key;
+			slot.used = true;
+			slot.second = value_type();
+			size_ += 1;
+		}
+		return slot.second;
+	}
+
+	/**
+	 * @brief Allocate enough slots for a number of keys, so that inserting them never rehashes.
+	 *
+	 * @param size is the number of keys.
+	 */
+	void reserve(size_type size) noexcept(NEX) {
+		auto capacity = std::min(capacity_for(size), max_capacity_);
+		if (capacity > slots_.size())
+			rehash(capacity);
+	}
+
+	/**
+	 * @brief Remove a key from the hash table.
+	 *
+	 * @param key to remove from the hash table.
+	 */
+	void remove(key_type key) noexcept(NEX) {
+		if (empty()) return;
+		auto hole = find_index(key);
+		if (!slots_[hole].used) return;
+
+		// Shift every entry that can legally move into the hole backwards, so that no probe
+		// sequence is broken by the removal.
+		auto next = (hole + 1) & mask_;
+		while (slots_[next].used) {
+			auto next_home = home(slots_[next].first);
+			if (((next - next_home) & mask_) >= ((next - hole) & mask_)) {
+				slots_[hole] = slots_[next];
+				hole = next;
+			}
+			next = (next + 1) & mask_;
+		}
+
+		slots_[hole].used = false;
+		size_ -= 1;
+	}
+
+	/**
+	 * @brief Remove every key from the hash table.
+	 *
+	 */
+	void clear() noexcept {
+		slots_type().swap(slots_);
+		size_ = 0;
+	}
+
+	/**
+	 * @brief Get an iterator to the first entry.
+	 *
+	 * @return iterator to the first entry.
+	 */
+	inline const_iterator begin() const noexcept {
+		return const_iterator(slots_.data(), slots_.data() + slots_.size());
+	}
+
+	/**
+	 * @brief Get an iterator past the last entry.
+	 *
+	 * @return iterator past the last entry.
+	 */
+	inline const_iterator end() const noexcept {
+		return const_iterator(slots_.data() + slots_.size(), slots_.data() + slots_.size());
+	}
+};
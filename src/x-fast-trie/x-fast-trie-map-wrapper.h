@@ -9,6 +9,8 @@
 
 #pragma once
 #include <unordered_map>
+#include <limits>
+#include <utility>
 
 /**
  * @brief Wrapper class for std::unordered_map.
@@ -21,8 +23,15 @@ class map_wrapper : public std::unordered_map<Key_, Value_> {
 public:
 	using key_type = Key_;
 	using value_type = Value_;
+	using size_type = typename std::unordered_map<Key_, Value_>::size_type;
 
 public:
+	/**
+	 * @brief Construct a new map_wrapper object. The upper bound on the number of keys is unused.
+	 * 
+	 */
+	map_wrapper(size_type = std::numeric_limits<size_type>::max()) {  }
+
 	/**
 	 * @brief Check if a key is in the hash table.
 	 * 
@@ -34,6 +43,24 @@ public:
 		return this->count(key) != 0; 
 	}
 
+	/**
+	 * @brief Prefetch a key. The buckets of std::unordered_map are not exposed, so this does
+	 * nothing.
+	 * 
+	 */
+	void prefetch(key_type) const noexcept {  }
+
+	/**
+	 * @brief Estimate the number of bytes allocated by the hash table. The nodes are not exposed,
+	 * so each entry is assumed to take a node with a next pointer and the entry, as in libstdc++.
+	 * 
+	 * @return estimated number of bytes allocated by the hash table.
+	 */
+	size_type memory_usage() const noexcept {
+		using node_type = std::pair<void*, typename std::unordered_map<Key_, Value_>::value_type>;
+		return this->bucket_count() * sizeof(void*) + this->size() * sizeof(node_type);
+	}
+
 	/**
 	 * @brief Remove a key from the hash table.
 	 * 
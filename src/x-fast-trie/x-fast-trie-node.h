@@ -1,7 +1,7 @@
 /**
  * @file x-fast-trie-node.h
  * @author Calvin Higgins (calvin_higgins2@uri.edu)
- * @brief XFastTrieNode class template.
+ * @brief XFastTrieNode and XFastTrieLeaf class templates.
  * @version 1.0
  * @date 2022-04-24
  * 
@@ -9,69 +9,98 @@
 
 #pragma once
 #include "../constants.h"
-#include "../augmented-pointer/augmented-pointer.h"
 #include <cstdint>
+#include <limits>
 #include <assert.h>
 #include <type_traits>
 
 /**
- * @brief Node structure that uses the lower bits of child pointers for control bits.
+ * @brief Internal node structure that links to its children and parent by handle instead of by
+ * pointer. The lowest bit of each child link marks a skip link and the handle is stored in the
+ * remaining bits. The node does not store its prefix, since the prefix is the key of the node in
+ * the level search structure that it is stored in.
  * 
- * @tparam Key_ is the key type of the node.
+ * @tparam Handle_ is the unsigned node handle type, where 0 is the null handle.
  */
-template <typename Key_>
+template <typename Handle_ = uint32_t>
 class XFastTrieNode {
 public:
-	using key_type = Key_;
-	static_assert(std::is_unsigned<key_type>::value, "Key type must be an unsigned integer.");
+	using handle_type = Handle_;
+	static_assert(std::is_unsigned<handle_type>::value, "Handle type must be an unsigned integer.");
 
-private:
-	using node_type = XFastTrieNode<key_type>;
-	using node_ptr = node_type*;
-	using aug_ptr = AugmentedPointer<node_ptr, 1>;
+	// The largest handle that fits in a child link next to the skip link bit.
+	static constexpr handle_type max_handle = std::numeric_limits<handle_type>::max() >> 1;
 
 private:
-	key_type key_;
+	handle_type left_;
+	handle_type right_;
+	handle_type parent_;
 
-	aug_ptr left_;
-	aug_ptr right_;
+	/**
+	 * @brief Make a child link.
+	 * 
+	 * @param handle of the child.
+	 * @param skip is whether the link is a skip link.
+	 * @return the child link.
+	 */
+	static inline handle_type make_link(handle_type handle, bool skip) noexcept(NEX) {
+		assert(handle <= max_handle && "Handle does not fit in a child link.");
+		return static_cast<handle_type>((handle << 1) | skip);
+	}
 
 public:
 	/**
 	 * @brief Construct a new XFastTrieNode object.
 	 * 
-	 * @param key is the node's key.
-	 * @param left is the node's left child pointer.
-	 * @param right is the node's right child pointer.
+	 * @param left is the node's left child handle.
+	 * @param right is the node's right child handle.
 	 */
-	XFastTrieNode(key_type key, node_ptr left, node_ptr right) 
-		: key_(key), left_(left), right_(right) {  }
+	XFastTrieNode(handle_type left, handle_type right) 
+		: left_(make_link(left, false)), right_(make_link(right, false)), parent_(0) {  }
 
 	/**
 	 * @brief Construct a new XFastTrieNode object with no children.
 	 * 
-	 * @param key is the node's key.
+	 * @param parent is the node's parent handle.
 	 */
-	XFastTrieNode(key_type key)
-		: key_(key), left_(nullptr), right_(nullptr) {  }
+	explicit XFastTrieNode(handle_type parent = 0)
+		: left_(0), right_(0), parent_(parent) {  }
 
 public:
 	/**
 	 * @brief Get the left child.
 	 * 
-	 * @return pointer to the left child. 
+	 * @return handle of the left child. 
 	 */
-	inline node_ptr get_left() const noexcept(NEX) {
-		return left_.get_ptr();
+	inline handle_type get_left() const noexcept {
+		return left_ >> 1;
 	}
 
 	/**
 	 * @brief Get the right child.
 	 * 
-	 * @return pointer to the right child. 
+	 * @return handle of the right child. 
+	 */
+	inline handle_type get_right() const noexcept {
+		return right_ >> 1;
+	}
+
+	/**
+	 * @brief Get the parent.
+	 * 
+	 * @return handle of the parent. 
+	 */
+	inline handle_type get_parent() const noexcept {
+		return parent_;
+	}
+
+	/**
+	 * @brief Set the parent.
+	 * 
+	 * @param parent is the new parent.
 	 */
-	inline node_ptr get_right() const noexcept(NEX) {
-		return right_.get_ptr();
+	inline void set_parent(handle_type parent) noexcept {
+		parent_ = parent;
 	}
 
 	/**
@@ -79,8 +108,8 @@ public:
 	 * 
 	 * @param left is the new left child.
 	 */
-	inline void set_left(node_ptr left) noexcept(NEX) {
-		left_.set_ptr(left);
+	inline void set_left(handle_type left) noexcept(NEX) {
+		left_ = make_link(left, false);
 	}
 
 	/**
@@ -88,8 +117,8 @@ public:
 	 * 
 	 * @param right is the new right child.
 	 */
-	inline void set_right(node_ptr right) noexcept(NEX) {
-		right_.set_ptr(right);
+	inline void set_right(handle_type right) noexcept(NEX) {
+		right_ = make_link(right, false);
 	}
 
 	/**
@@ -97,9 +126,8 @@ public:
 	 * 
 	 * @param left is the new left child.
 	 */
-	inline void set_left_skip_link(node_ptr left) noexcept(NEX) {
-		left_.set_ptr(left);
-		left_.set_bit(0);
+	inline void set_left_skip_link(handle_type left) noexcept(NEX) {
+		left_ = make_link(left, true);
 	}
 
 	/**
@@ -107,9 +135,8 @@ public:
 	 * 
 	 * @param right is the new right child.
 	 */
-	inline void set_right_skip_link(node_ptr right) noexcept(NEX) {
-		right_.set_ptr(right);
-		right_.set_bit(0);
+	inline void set_right_skip_link(handle_type right) noexcept(NEX) {
+		right_ = make_link(right, true);
 	}
 
 	/**
@@ -118,8 +145,8 @@ public:
 	 * @return true if the left child is a skip link.
 	 * @return false if the left child is not a skip link.
 	 */
-	inline bool is_left_skip_link() const noexcept(NEX) {
-		return left_.is_set_bit(0);
+	inline bool is_left_skip_link() const noexcept {
+		return left_ & 1;
 	}
 
 	/**
@@ -128,16 +155,144 @@ public:
 	 * @return true if the right child is a skip link.
 	 * @return false if the right child is not a skip link.
 	 */
-	inline bool is_right_skip_link() const noexcept(NEX) {
-		return right_.is_set_bit(0);
+	inline bool is_right_skip_link() const noexcept {
+		return right_ & 1;
+	}
+
+	/**
+	 * @brief Check if the left child is an internal node or a leaf of the subtree, rather than
+	 * a skip link or nothing.
+	 * 
+	 * @return true if the left child exists.
+	 * @return false if the left child does not exist.
+	 */
+	inline bool has_left_child() const noexcept {
+		return get_left() != 0 && !is_left_skip_link();
+	}
+
+	/**
+	 * @brief Check if the right child is an internal node or a leaf of the subtree, rather than
+	 * a skip link or nothing.
+	 * 
+	 * @return true if the right child exists.
+	 * @return false if the right child does not exist.
+	 */
+	inline bool has_right_child() const noexcept {
+		return get_right() != 0 && !is_right_skip_link();
+	}
+};
+
+/**
+ * @brief Leaf node structure. The left and right links of a leaf are its neighbors in the leaf
+ * list, and the leaf carries its key and a payload.
+ * 
+ * @tparam Key_ is the key type of the node.
+ * @tparam Payload_ is the payload type of the node, or void for no payload.
+ * @tparam Handle_ is the unsigned node handle type, where 0 is the null handle.
+ */
+template <typename Key_, typename Payload_ = void, typename Handle_ = uint32_t>
+class XFastTrieLeaf : public XFastTrieNode<Handle_> {
+public:
+	using key_type = Key_;
+	using payload_type = Payload_;
+	using handle_type = Handle_;
+	static_assert(std::is_unsigned<key_type>::value, "Key type must be an unsigned integer.");
+
+private:
+	using node_type = XFastTrieNode<handle_type>;
+
+private:
+	key_type key_;
+	payload_type payload_;
+
+public:
+	/**
+	 * @brief Construct a new XFastTrieLeaf object with a default payload.
+	 * 
+	 * @param key is the node's key.
+	 * @param left is the handle of the previous leaf.
+	 * @param right is the handle of the next leaf.
+	 */
+	XFastTrieLeaf(key_type key, handle_type left, handle_type right)
+		: node_type(left, right), key_(key), payload_() {  }
+
+	/**
+	 * @brief Construct a new XFastTrieLeaf object.
+	 * 
+	 * @param key is the node's key.
+	 * @param left is the handle of the previous leaf.
+	 * @param right is the handle of the next leaf.
+	 * @param payload is the node's payload.
+	 */
+	XFastTrieLeaf(key_type key, handle_type left, handle_type right, payload_type payload)
+		: node_type(left, right), key_(key), payload_(payload) {  }
+
+public:
+	/**
+	 * @brief Get the key of the node.
+	 * 
+	 * @return key of the node. 
+	 */
+	inline key_type key() const noexcept {
+		return key_;
+	}
+
+	/**
+	 * @brief Get the payload of the node.
+	 * 
+	 * @return payload of the node.
+	 */
+	inline payload_type payload() const noexcept(NEX) {
+		return payload_;
 	}
 
+	/**
+	 * @brief Set the payload of the node.
+	 * 
+	 * @param payload is the new payload.
+	 */
+	inline void set_payload(payload_type payload) noexcept(NEX) {
+		payload_ = payload;
+	}
+};
+
+/**
+ * @brief Leaf node structure without a payload, so that a plain set pays nothing for it.
+ * 
+ * @tparam Key_ is the key type of the node.
+ * @tparam Handle_ is the unsigned node handle type, where 0 is the null handle.
+ */
+template <typename Key_, typename Handle_>
+class XFastTrieLeaf<Key_, void, Handle_> : public XFastTrieNode<Handle_> {
+public:
+	using key_type = Key_;
+	using handle_type = Handle_;
+	static_assert(std::is_unsigned<key_type>::value, "Key type must be an unsigned integer.");
+
+private:
+	using node_type = XFastTrieNode<handle_type>;
+
+private:
+	key_type key_;
+
+public:
+	/**
+	 * @brief Construct a new XFastTrieLeaf object.
+	 * 
+	 * @param key is the node's key.
+	 * @param left is the handle of the previous leaf.
+	 * @param right is the handle of the next leaf.
+	 */
+	XFastTrieLeaf(key_type key, handle_type left, handle_type right)
+		: node_type(left, right), key_(key) {  }
+
+public:
 	/**
 	 * @brief Get the key of the node.
 	 * 
 	 * @return key of the node. 
 	 */
-	inline key_type key() const noexcept(NEX) {
+	inline key_type key() const noexcept {
 		return key_;
 	}
 };
\ No newline at end of file
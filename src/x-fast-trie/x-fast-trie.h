@@ -9,7 +9,11 @@
 
 #pragma once
 #include "x-fast-trie-node.h"
+#include "x-fast-trie-flat-map.h"
 #include "x-fast-trie-map-wrapper.h"
+#include "../node-pool/node-arena.h"
+#include "../memory-breakdown/memory-breakdown.h"
+#include "../operation-stats/operation-stats.h"
 #include "../constants.h"
 #include <optional>
 #include <vector>
@@ -17,33 +21,94 @@
 #include <type_traits>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <algorithm>
 
 /**
  * @brief Data structure for fast dynamic ordered set operations on a bounded universe.
  * 
+ * The hash table used by the level search structures is a policy. Map_<K, V> must provide
+ *   - Map_(size_type max_size), where max_size bounds the number of keys ever stored,
+ *   - bool contains(K key) const,
+ *   - void prefetch(K key) const, a hint that the key will be looked up soon,
+ *   - const V& at(K key) const and V& at(K key), for keys in the table,
+ *   - V& operator[](K key), inserting a default value if the key is missing,
+ *   - void remove(K key),
+ *   - void reserve(size_type size), sizing the table for a number of keys,
+ *   - size_type size() const,
+ *   - size_type memory_usage() const, the number of bytes allocated by the table,
+ *   - begin() and end() iterating over entries with members first and second.
+ * flat_map and map_wrapper both satisfy these requirements.
+ * 
+ * Nodes are allocated by a policy and refer to each other by 32-bit handles instead of pointers,
+ * so an internal node takes 12 bytes and a level search structure stores a 32-bit value for each
+ * prefix. Allocator_<T> must provide
+ *   - handle_type, an unsigned integer type where 0 is never the handle of a node,
+ *   - handle_type create(Args&&... args), constructing a node from the arguments,
+ *   - T* at(handle_type handle) const, resolving the handle of a live node to a pointer that stays
+ *     valid until the node is destroyed,
+ *   - void destroy(handle_type handle), for nodes created by the same allocator,
+ *   - size_type size() const, the number of live nodes,
+ *   - size_type memory_usage() const, the number of bytes allocated for nodes,
+ *   - a destructor that frees every node that has not been destroyed.
+ * NodeArena satisfies these requirements. Since the destructor of the trie leaves the nodes to the
+ * allocator, leaf payloads must be trivially destructible.
+ * 
+ * The operations report their work to an instrumentation policy, which counts hash probes and
+ * binary search steps while searching and nodes as they are allocated and freed. The default
+ * NoStats policy counts nothing and costs nothing, while OperationStats keeps counters that
+ * operation_counters() returns as a snapshot.
+ * 
  * @tparam Key_ is the key type.
+ * @tparam Map_ is the hash table type.
+ * @tparam Allocator_ is the node allocator type.
+ * @tparam Payload_ is the type of the value stored in each leaf, or void for no value.
+ * @tparam Stats_ is the instrumentation policy.
  */
-template <typename Key_>
-class XFastTrie {
+template <typename Key_, template <typename, typename> class Map_ = flat_map, 
+          template <typename> class Allocator_ = NodeArena, typename Payload_ = void,
+          typename Stats_ = NoStats>
+class XFastTrie : private Stats_ {
 public:
 	using key_type = Key_;
 	static_assert(std::is_unsigned<key_type>::value, "Key type must be an unsigned integer.");
 
 	using some_key_type = std::optional<key_type>;
 	using size_type = size_t;
+	using stats_type = Stats_;
 
 private:
-	using node_type = XFastTrieNode<key_type>;
+	using node_type = XFastTrieNode<>;
 	using node_ptr = node_type*;
-	using node_ptr_pair = std::pair<node_ptr, node_ptr>;
 
-	using level_type = map_wrapper<key_type, node_ptr>;
+	// Leaves only carry a payload when one is requested, so that a plain set pays nothing for it.
+	using payload_type = Payload_;
+	using leaf_type = XFastTrieLeaf<key_type, payload_type>;
+	using leaf_ptr = leaf_type*;
+
+	using node_allocator_type = Allocator_<node_type>;
+	using leaf_allocator_type = Allocator_<leaf_type>;
+
+	// Internal nodes and leaves come from separate allocators. The level of a node tells which
+	// allocator its handle belongs to, since only the bottom level and the skip links hold leaves.
+	using handle_type = typename node_allocator_type::handle_type;
+	using handle_pair = std::pair<handle_type, handle_type>;
+
+	static_assert(std::is_same<handle_type, typename node_type::handle_type>::value &&
+	              std::is_same<handle_type, typename leaf_allocator_type::handle_type>::value,
+	              "Allocators must use the handle type of the nodes.");
+
+	using level_type = Map_<key_type, handle_type>;
 	using lss_type = std::vector<level_type>;
 
 protected:
 	size_type size_;
 	lss_type lss_;
 
+private:
+	node_allocator_type node_allocator_;
+	leaf_allocator_type leaf_allocator_;
+
 private:
 	// The number of bits in the keys.
 	static constexpr size_type bit_length_ = std::numeric_limits<key_type>::digits;
@@ -58,10 +123,28 @@ private:
 	static_assert(upper_bound_ >= 0, "Maximum possible key must be nonnegative.");
 	static_assert(lower_bound_ == 0, "Minimum possible key must be 0.");
 
+	// The number of keys whose searches are interleaved by the batch operations.
+	static constexpr size_type batch_size_ = 16;
+
+	/**
+	 * @brief Get the maximum number of prefixes that can be stored on a level.
+	 * 
+	 * @param level_index of the level.
+	 * @return the maximum number of prefixes on the level.
+	 */
+	static constexpr size_type max_level_size(size_type level_index) noexcept {
+		if (level_index >= std::numeric_limits<size_type>::digits)
+			return std::numeric_limits<size_type>::max();
+		return static_cast<size_type>(1) << level_index;
+	}
+
 private:
 	static constexpr bool left_ = 0;
 	static constexpr bool right_ = 1;
 
+	// The handle that does not refer to any node.
+	static constexpr handle_type null_handle_ = 0;
+
 private:
 
 	/**
@@ -86,6 +169,15 @@ private:
 		return prefix & 1;
 	}
 
+	/**
+	 * @brief Get the instrumentation policy, which is an empty base when nothing is counted.
+	 * 
+	 * @return the instrumentation policy.
+	 */
+	inline const stats_type& stats() const noexcept {
+		return *this;
+	}
+
 	/**
 	 * @brief Get the level index of the longest matching prefix of a given key.
 	 * 
@@ -101,6 +193,8 @@ private:
 		while (low_level <= high_level) {
 			size_type mid_level = (low_level + high_level) >> 1;
 			auto prefix = get_prefix(key, mid_level);
+			stats().count_search_step();
+			stats().count_hash_probe();
 			if (lss_.at(mid_level).contains(prefix)) 
 				low_level = mid_level + 1;
 			else 
@@ -110,24 +204,90 @@ private:
 		return low_level - 1;
 	}
 
+	/**
+	 * @brief Get an internal node from its handle.
+	 * 
+	 * @param handle of the internal node.
+	 * @return the internal node.
+	 */
+	inline node_ptr get_node(handle_type handle) const noexcept {
+		return node_allocator_.at(handle);
+	}
+
+	/**
+	 * @brief Get a node on a given level from its handle. The nodes on the bottom level are
+	 * leaves.
+	 * 
+	 * @param handle of the node.
+	 * @param level_index of the node.
+	 * @return the node.
+	 */
+	inline node_ptr get_node(handle_type handle, size_type level_index) const noexcept {
+		if (level_index == bit_length()) return leaf_allocator_.at(handle);
+		return node_allocator_.at(handle);
+	}
+
+	/**
+	 * @brief Get a leaf from its handle.
+	 * 
+	 * @param handle of the leaf, which may be the null handle.
+	 * @return the leaf or nullptr for the null handle.
+	 */
+	inline leaf_ptr get_leaf(handle_type handle) const noexcept {
+		if (handle == null_handle_) return nullptr;
+		return leaf_allocator_.at(handle);
+	}
+
+	/**
+	 * @brief Get the leaf after a given leaf in key order.
+	 * 
+	 * @param leaf to get the next leaf of.
+	 * @return the next leaf or nullptr if the leaf is the last leaf.
+	 */
+	inline leaf_ptr get_next_leaf(leaf_ptr leaf) const noexcept {
+		return get_leaf(leaf->get_right());
+	}
+
+	/**
+	 * @brief Get the leaf before a given leaf in key order.
+	 * 
+	 * @param leaf to get the previous leaf of.
+	 * @return the previous leaf or nullptr if the leaf is the first leaf.
+	 */
+	inline leaf_ptr get_previous_leaf(leaf_ptr leaf) const noexcept {
+		return get_leaf(leaf->get_left());
+	}
+
+	/**
+	 * @brief Follow the skip link of the internal node with the longest matching prefix of a key.
+	 * 
+	 * @param handle of the internal node.
+	 * @return the handle of the leaf that the skip link points to.
+	 */
+	inline handle_type follow_skip_link(handle_type handle) const noexcept {
+		// The child on the side of the key does not exist, so that side must be a skip link.
+		auto node = get_node(handle);
+		assert(node->is_left_skip_link() || node->is_right_skip_link());
+		return node->is_left_skip_link() ? node->get_left() : node->get_right();
+	}
+
 	/**
 	 * @brief Get a leaf that is close to a given key. 
 	 * 
 	 * @param key to find a close leaf to.
-	 * @return the close leaf.
+	 * @return the handle of the close leaf.
 	 */
-	node_ptr get_close_leaf(key_type key) const noexcept(NEX) {
+	handle_type get_close_leaf(key_type key) const noexcept(NEX) {
 		// Get the node with the longest matching prefix.
 		auto lmp_level = get_lmp_level(key);
 		auto prefix = get_prefix(key, lmp_level);
+		stats().count_hash_probe();
 		auto lmp_node = lss_.at(lmp_level).at(prefix);
 
 		// If the node is an internal node, we need to traverse down the skip link.
 		// Otherwise, the node is already a leaf node so we do nothing.
-		if (lmp_node->is_left_skip_link())
-			lmp_node = lmp_node->get_left();
-		else if (lmp_node->is_right_skip_link())
-			lmp_node = lmp_node->get_right();
+		if (lmp_level < bit_length())
+			lmp_node = follow_skip_link(lmp_node);
 
 		return lmp_node;
 	}
@@ -138,11 +298,21 @@ private:
 	 * @param key to get the predecessor node of.
 	 * @return the predecessor node.
 	 */
-	node_ptr get_predecessor_node(key_type key) const noexcept(NEX) {
+	leaf_ptr get_predecessor_node(key_type key) const noexcept(NEX) {
 		if (empty()) return nullptr;
-		auto node = get_close_leaf(key);
+		return get_predecessor_node(key, get_leaf(get_close_leaf(key)));
+	}
+
+	/**
+	 * @brief Get the predecessor node of a given key from a leaf that is close to the key.
+	 * 
+	 * @param key to get the predecessor node of.
+	 * @param node is a leaf that is close to the key.
+	 * @return the predecessor node.
+	 */
+	inline leaf_ptr get_predecessor_node(key_type key, leaf_ptr node) const noexcept(NEX) {
 		if (key <= node->key())
-			return node->get_left();
+			return get_previous_leaf(node);
 		return node;
 	}
 
@@ -152,11 +322,21 @@ private:
 	 * @param key to get the successor node of.
 	 * @return the successor node.
 	 */
-	node_ptr get_successor_node(key_type key) const noexcept(NEX) {
+	leaf_ptr get_successor_node(key_type key) const noexcept(NEX) {
 		if (empty()) return nullptr;
-		auto node = get_close_leaf(key);
+		return get_successor_node(key, get_leaf(get_close_leaf(key)));
+	}
+
+	/**
+	 * @brief Get the successor node of a given key from a leaf that is close to the key.
+	 * 
+	 * @param key to get the successor node of.
+	 * @param node is a leaf that is close to the key.
+	 * @return the successor node.
+	 */
+	inline leaf_ptr get_successor_node(key_type key, leaf_ptr node) const noexcept(NEX) {
 		if (key >= node->key())
-			return node->get_right();
+			return get_next_leaf(node);
 		return node;
 	}
 
@@ -166,28 +346,119 @@ private:
 	 * @param key to get the successor node of.
 	 * @return the successor node.
 	 */
-	node_ptr get_inclusive_successor_node(key_type key) const noexcept(NEX) {
+	leaf_ptr get_inclusive_successor_node(key_type key) const noexcept(NEX) {
 		if (empty()) return nullptr;
-		auto node = get_close_leaf(key);
+		return get_inclusive_successor_node(key, get_leaf(get_close_leaf(key)));
+	}
+
+	/**
+	 * @brief Get the inclusive successor node of a given key from a leaf that is close to the key.
+	 * 
+	 * @param key to get the successor node of.
+	 * @param node is a leaf that is close to the key.
+	 * @return the successor node.
+	 */
+	inline leaf_ptr get_inclusive_successor_node(key_type key, leaf_ptr node) const noexcept(NEX) {
 		if (key > node->key())
-			return node->get_right();
+			return get_next_leaf(node);
 		return node;
 	}
 
 	/**
-	 * @brief Get the predecessor and successor nodes of a given key.
+	 * @brief Get leaves that are close to a group of keys. The binary searches over the levels
+	 * advance in lockstep and every round first prefetches the slots that all of the searches are
+	 * about to probe, so that the cache misses of different keys overlap.
+	 * 
+	 * @param keys to find close leaves to. The trie must not be empty.
+	 * @param count is the number of keys, at most batch_size_.
+	 * @param leaves receives the close leaf of each key.
+	 */
+	void get_close_leaves(const key_type* keys, size_type count, leaf_ptr* leaves) const noexcept(NEX) {
+		assert(!empty() && count <= batch_size_);
+		size_type low_levels[batch_size_];
+		size_type high_levels[batch_size_];
+		for (size_type i = 0; i < count; ++i) {
+			low_levels[i] = 0;
+			high_levels[i] = bit_length();
+		}
+
+		// Binary search for the longest matching prefixes, one level per key per round.
+		bool searching = true;
+		while (searching) {
+			for (size_type i = 0; i < count; ++i) {
+				if (low_levels[i] > high_levels[i]) continue;
+				auto mid_level = (low_levels[i] + high_levels[i]) >> 1;
+				lss_.at(mid_level).prefetch(get_prefix(keys[i], mid_level));
+			}
+
+			searching = false;
+			for (size_type i = 0; i < count; ++i) {
+				if (low_levels[i] > high_levels[i]) continue;
+				auto mid_level = (low_levels[i] + high_levels[i]) >> 1;
+				stats().count_search_step();
+				stats().count_hash_probe();
+				if (lss_.at(mid_level).contains(get_prefix(keys[i], mid_level)))
+					low_levels[i] = mid_level + 1;
+				else
+					high_levels[i] = mid_level - 1;
+				searching |= low_levels[i] <= high_levels[i];
+			}
+		}
+
+		// Get the nodes with the longest matching prefixes.
+		for (size_type i = 0; i < count; ++i) {
+			auto lmp_level = low_levels[i] - 1;
+			lss_.at(lmp_level).prefetch(get_prefix(keys[i], lmp_level));
+		}
+		handle_type handles[batch_size_];
+		for (size_type i = 0; i < count; ++i) {
+			auto lmp_level = low_levels[i] - 1;
+			stats().count_hash_probe();
+			handles[i] = lss_.at(lmp_level).at(get_prefix(keys[i], lmp_level));
+			__builtin_prefetch(get_node(handles[i], lmp_level));
+		}
+
+		// Traverse down the skip links of the internal nodes.
+		for (size_type i = 0; i < count; ++i) {
+			if (low_levels[i] - 1 < bit_length())
+				handles[i] = follow_skip_link(handles[i]);
+			leaves[i] = get_leaf(handles[i]);
+			__builtin_prefetch(leaves[i]);
+		}
+	}
+
+	/**
+	 * @brief Get the inclusive successor nodes of a group of keys.
 	 * 
-	 * @param key to get the predecessor and successor nodes of.
-	 * @return pair containing the predecessor and successor nodes of a given key. 
+	 * @param keys to get the successor nodes of.
+	 * @param count is the number of keys, at most batch_size_.
+	 * @param nodes receives the successor node of each key.
 	 */
-	node_ptr_pair get_predecessor_and_successor_nodes(key_type key) const noexcept(NEX) {
-		if (empty()) return node_ptr_pair(nullptr, nullptr);
-		auto node = get_close_leaf(key);
+	void get_inclusive_successor_nodes(const key_type* keys, size_type count, leaf_ptr* nodes) const noexcept(NEX) {
+		if (empty()) {
+			std::fill(nodes, nodes + count, nullptr);
+			return;
+		}
+		get_close_leaves(keys, count, nodes);
+		for (size_type i = 0; i < count; ++i)
+			nodes[i] = get_inclusive_successor_node(keys[i], nodes[i]);
+	}
+
+	/**
+	 * @brief Get the predecessor and successor leaves of a given key.
+	 * 
+	 * @param key to get the predecessor and successor leaves of.
+	 * @return pair containing the handles of the predecessor and successor leaves of a given key. 
+	 */
+	handle_pair get_predecessor_and_successor_leaves(key_type key) const noexcept(NEX) {
+		if (empty()) return handle_pair(null_handle_, null_handle_);
+		auto handle = get_close_leaf(key);
+		auto node = get_leaf(handle);
 		if (key < node->key())
-			return node_ptr_pair(node->get_left(), node);
+			return handle_pair(node->get_left(), handle);
 		if (key > node->key())
-			return node_ptr_pair(node, node->get_right());
-		return node_ptr_pair(node->get_left(), node->get_right());
+			return handle_pair(handle, node->get_right());
+		return handle_pair(node->get_left(), node->get_right());
 	}
 
 	/**
@@ -196,8 +467,128 @@ private:
 	 * @param key to get the leaf node of.
 	 * @return the leaf node.
 	 */
-	node_ptr get_leaf_node(key_type key) const noexcept {
-		return lss_.back().at(key);
+	leaf_ptr get_leaf_node(key_type key) const noexcept {
+		return get_leaf(lss_.back().at(key));
+	}
+
+	/**
+	 * @brief Create a leaf that is not yet linked into the trie.
+	 * 
+	 * @param key of the leaf.
+	 * @param args to forward to the leaf constructor after the key and the leaf links.
+	 * @return the handle of the leaf.
+	 */
+	template <typename... Args>
+	inline handle_type create_leaf(key_type key, Args&&... args) noexcept(NEX) {
+		stats().count_node_allocation();
+		return leaf_allocator_.create(key, null_handle_, null_handle_, std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief Create an internal node.
+	 * 
+	 * @param args to forward to the node constructor.
+	 * @return the handle of the node.
+	 */
+	template <typename... Args>
+	inline handle_type create_node(Args&&... args) noexcept(NEX) {
+		stats().count_node_allocation();
+		return node_allocator_.create(std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief Destroy an internal node.
+	 * 
+	 * @param handle of the node.
+	 */
+	inline void destroy_node(handle_type handle) noexcept(NEX) {
+		stats().count_node_free();
+		node_allocator_.destroy(handle);
+	}
+
+	/**
+	 * @brief Destroy a leaf.
+	 * 
+	 * @param handle of the leaf.
+	 */
+	inline void destroy_leaf(handle_type handle) noexcept(NEX) {
+		stats().count_node_free();
+		leaf_allocator_.destroy(handle);
+	}
+
+	/**
+	 * @brief Build every level of an empty trie bottom-up from its leaves in a single pass. The
+	 * nodes of each level are found by grouping the sorted nodes of the level below by their
+	 * parent prefix, so every node is created once, its skip link is set once from the smallest
+	 * or largest leaf of its subtree, and each level search structure is sized exactly before it
+	 * is filled.
+	 * 
+	 * @param leaves created by create_leaf, in strictly increasing key order.
+	 */
+	void build_levels(const std::vector<handle_type>& leaves) noexcept(NEX) {
+		assert(empty() && "Cannot build the levels of a non-empty trie.");
+		if (leaves.empty()) return;
+
+		// Link the leaves and fill the bottom level.
+		auto& bottom = lss_.at(bit_length());
+		bottom.reserve(leaves.size());
+		for (size_type i = 0; i < leaves.size(); ++i) {
+			auto leaf = get_leaf(leaves[i]);
+			assert((i == 0 || get_leaf(leaves[i - 1])->key() < leaf->key()) && "Keys must be strictly increasing.");
+			if (i > 0) leaf->set_left(leaves[i - 1]);
+			if (i + 1 < leaves.size()) leaf->set_right(leaves[i + 1]);
+			bottom[leaf->key()] = leaves[i];
+		}
+		size_ = leaves.size();
+
+		// Each node is paired with its prefix, since internal nodes do not store their prefixes,
+		// and with the smallest and largest leaves of its subtree.
+		struct subtree_type {
+			key_type prefix;
+			handle_type node;
+			handle_type min_leaf;
+			handle_type max_leaf;
+		};
+
+		std::vector<subtree_type> children, parents;
+		children.reserve(leaves.size());
+		for (auto leaf : leaves)
+			children.push_back(subtree_type{get_leaf(leaf)->key(), leaf, leaf, leaf});
+
+		for (int level_index = bit_length() - 1; level_index >= 0; --level_index) {
+			// The prefix of a parent is the prefix of its children without the last bit. Since
+			// the children are sorted, children with the same parent are adjacent.
+			parents.clear();
+			for (auto& child : children) {
+				auto prefix = static_cast<key_type>(child.prefix >> 1);
+				if (parents.empty() || parents.back().prefix != prefix)
+					parents.push_back(subtree_type{prefix, create_node(), child.min_leaf, child.max_leaf});
+
+				auto& parent = parents.back();
+				auto parent_node = get_node(parent.node);
+				get_node(child.node, level_index + 1)->set_parent(parent.node);
+				if (get_direction(child.prefix) == left_) {
+					parent_node->set_left(child.node);
+				} else {
+					parent_node->set_right(child.node);
+					parent.max_leaf = child.max_leaf;
+				}
+			}
+
+			// A missing child becomes a skip link to the nearest leaf in the other subtree.
+			auto& level = lss_.at(level_index);
+			level.reserve(parents.size());
+			for (auto& parent : parents) {
+				auto parent_node = get_node(parent.node);
+				if (parent_node->get_left() == null_handle_)
+					parent_node->set_left_skip_link(parent.min_leaf);
+				else if (parent_node->get_right() == null_handle_)
+					parent_node->set_right_skip_link(parent.max_leaf);
+				level[parent.prefix] = parent.node;
+			}
+
+			children.swap(parents);
+		}
 	}
 
 public:
@@ -236,7 +627,26 @@ public:
 	XFastTrie() : size_(0) {
 		lss_.reserve(bit_length());
 		for (size_type i = 0; i <= bit_length(); ++i)
-			lss_.push_back(level_type());
+			lss_.push_back(level_type(max_level_size(i)));
+	}
+
+	/**
+	 * @brief Construct a new XFastTrie object from a sorted range of keys. The levels are built
+	 * bottom-up instead of inserting the keys one at a time.
+	 * 
+	 * @param first key of the range.
+	 * @param last key of the range, exclusive. Duplicate keys are ignored.
+	 */
+	template <typename Iterator_>
+	XFastTrie(Iterator_ first, Iterator_ last) : XFastTrie() {
+		std::vector<handle_type> leaves;
+		for (; first != last; ++first) {
+			key_type key = *first;
+			assert((leaves.empty() || get_leaf(leaves.back())->key() <= key) && "Keys must be sorted.");
+			if (!leaves.empty() && get_leaf(leaves.back())->key() == key) continue;
+			leaves.push_back(create_leaf(key));
+		}
+		build_levels(leaves);
 	}
 
 	/**
@@ -258,6 +668,50 @@ public:
 		return size() == 0;
 	}
 
+	/**
+	 * @brief Get the heap memory of the trie by category. The allocators and hash tables keep
+	 * count of their memory, so this takes time linear in the bit length of the keys rather
+	 * than in the number of keys.
+	 * 
+	 * @return MemoryBreakdown memory of the nodes, level search structures and free node slots.
+	 */
+	MemoryBreakdown memory_breakdown() const noexcept(NEX) {
+		MemoryBreakdown breakdown;
+		breakdown.nodes = node_allocator_.size() * sizeof(node_type) + leaf_allocator_.size() * sizeof(leaf_type);
+		breakdown.slack = node_allocator_.memory_usage() + leaf_allocator_.memory_usage() - breakdown.nodes;
+		breakdown.tables = lss_.capacity() * sizeof(level_type);
+		for (auto& level : lss_)
+			breakdown.tables += level.memory_usage();
+		return breakdown;
+	}
+
+	/**
+	 * @brief Get the heap memory of the trie.
+	 * 
+	 * @return size_type number of bytes allocated by the trie.
+	 */
+	size_type memory_usage() const noexcept(NEX) {
+		return memory_breakdown().total();
+	}
+
+	/**
+	 * @brief Get the work done by the operations on the trie since it was created or its counters
+	 * were last reset. Every counter is 0 unless the trie is instrumented with OperationStats.
+	 * 
+	 * @return OperationCounters snapshot of the counters.
+	 */
+	OperationCounters operation_counters() const noexcept {
+		return stats().snapshot();
+	}
+
+	/**
+	 * @brief Set every operation counter to 0.
+	 * 
+	 */
+	void reset_operation_counters() noexcept {
+		stats().reset();
+	}
+
 	/**
 	 * @brief Check if the trie contains a key.
 	 * 
@@ -297,6 +751,70 @@ public:
 		return some_key_type();
 	}
 
+	/**
+	 * @brief Check if the trie contains each key of a batch.
+	 * 
+	 * @param keys to check.
+	 * @param count is the number of keys.
+	 * @param results receives whether the trie contains each key.
+	 */
+	void contains_batch(const key_type* keys, size_type count, bool* results) const noexcept(NEX) {
+		auto& leaves = lss_.at(bit_length());
+		for (size_type first = 0; first < count; first += batch_size_) {
+			auto last = std::min(count, first + batch_size_);
+			for (size_type i = first; i < last; ++i)
+				leaves.prefetch(keys[i]);
+			for (size_type i = first; i < last; ++i)
+				results[i] = leaves.contains(keys[i]);
+		}
+	}
+
+	/**
+	 * @brief Find the predecessor of each key of a batch.
+	 * 
+	 * @param keys to find the predecessors of.
+	 * @param count is the number of keys.
+	 * @param results receives the predecessor of each key, or none if it does not exist.
+	 */
+	void predecessor_batch(const key_type* keys, size_type count, some_key_type* results) const noexcept(NEX) {
+		if (empty()) {
+			std::fill(results, results + count, some_key_type());
+			return;
+		}
+		leaf_ptr leaves[batch_size_];
+		for (size_type first = 0; first < count; first += batch_size_) {
+			auto group_size = std::min(batch_size_, count - first);
+			get_close_leaves(keys + first, group_size, leaves);
+			for (size_type i = 0; i < group_size; ++i) {
+				auto node = get_predecessor_node(keys[first + i], leaves[i]);
+				results[first + i] = node != nullptr ? some_key_type(node->key()) : some_key_type();
+			}
+		}
+	}
+
+	/**
+	 * @brief Find the successor of each key of a batch.
+	 * 
+	 * @param keys to find the successors of.
+	 * @param count is the number of keys.
+	 * @param results receives the successor of each key, or none if it does not exist.
+	 */
+	void successor_batch(const key_type* keys, size_type count, some_key_type* results) const noexcept(NEX) {
+		if (empty()) {
+			std::fill(results, results + count, some_key_type());
+			return;
+		}
+		leaf_ptr leaves[batch_size_];
+		for (size_type first = 0; first < count; first += batch_size_) {
+			auto group_size = std::min(batch_size_, count - first);
+			get_close_leaves(keys + first, group_size, leaves);
+			for (size_type i = 0; i < group_size; ++i) {
+				auto node = get_successor_node(keys[first + i], leaves[i]);
+				results[first + i] = node != nullptr ? some_key_type(node->key()) : some_key_type();
+			}
+		}
+	}
+
 	/**
 	 * @brief Find the minimum key.
 	 * 
@@ -327,99 +845,116 @@ public:
 	 * @param key to insert into the trie.
 	 */
 	void insert(key_type key) noexcept(NEX) {
+		emplace(key);
+	}
+
+private:
+	/**
+	 * @brief Insert a key into the trie, constructing its leaf from the given arguments.
+	 * 
+	 * @param key to insert into the trie.
+	 * @param args to forward to the leaf constructor after the key and the leaf links.
+	 */
+	template <typename... Args>
+	void emplace(key_type key, Args&&... args) noexcept(NEX) {
 		// Prevent double insertions.
 		if (contains(key)) return;
 
-		// Get the predecessor and successor nodes.
-		auto pred_and_succ = get_predecessor_and_successor_nodes(key);
+		// Get the predecessor and successor leaves.
+		auto pred_and_succ = get_predecessor_and_successor_leaves(key);
 		auto pred = pred_and_succ.first;
 		auto succ = pred_and_succ.second;
 
 		// Create the new leaf node.
-		auto leaf = new node_type(key, pred, succ);
+		stats().count_node_allocation();
+		auto leaf = leaf_allocator_.create(key, pred, succ, std::forward<Args>(args)...);
 		lss_.at(bit_length())[key] = leaf;
 		size_ += 1;
 
 		// Insert the new leaf node into the bottom of the trie.
-		if (pred != nullptr) 
-			pred->set_right(leaf);
+		if (pred != null_handle_) 
+			get_leaf(pred)->set_right(leaf);
 
-		if (succ != nullptr) 
-			succ->set_left(leaf);
+		if (succ != null_handle_) 
+			get_leaf(succ)->set_left(leaf);
 
 		// Create the root if it does not exist.
 		if (!lss_.at(0).contains(0))
-			lss_.at(0)[0] = new node_type(0);
+			lss_.at(0)[0] = create_node();
 		
 		// Insert new internal nodes and update skip links.
 		auto parent = lss_.at(0).at(0);
 		for (int level_index = 1; level_index < bit_length(); ++level_index) {
 			auto prefix = get_prefix(key, level_index);
 			auto direction = get_direction(prefix);
+			auto parent_node = get_node(parent);
 
 			if (direction == left_) {
-				// If the left pointer of the parent is nullptr or is a skip link,
+				// If the left link of the parent is null or is a skip link,
 				// the left internal node does not exist so we insert a new internal node.
-				if (parent->get_left() == nullptr || parent->is_left_skip_link()) {
-					auto node = new node_type(prefix);
+				if (parent_node->get_left() == null_handle_ || parent_node->is_left_skip_link()) {
+					auto node = create_node(parent);
 					lss_.at(level_index)[prefix] = node;
-					parent->set_left(node);
+					parent_node->set_left(node);
 				}
 
-				// If the right pointer of the parent is nullptr, we must have created the parent
-				// in the last step. Then, the right pointer should become a skip link to the new 
+				// If the right link of the parent is null, we must have created the parent
+				// in the last step. Then, the right link should become a skip link to the new 
 				// leaf node. Also, if the parent already has a right skip link, then we need to
 				// update the right skip link if the new leaf has a lesser key, because the right
 				// skip link must always point to the smallest leaf in the subtree.
-				if ((parent->get_right() == nullptr) ||
-				    (parent->is_right_skip_link() && key > parent->get_right()->key())) {
-					parent->set_right_skip_link(leaf);
+				if ((parent_node->get_right() == null_handle_) ||
+				    (parent_node->is_right_skip_link() && key > get_leaf(parent_node->get_right())->key())) {
+					parent_node->set_right_skip_link(leaf);
 				} 
 
 				// Set the parent to the left child because we traversed to the left.
-				parent = parent->get_left();
+				parent = parent_node->get_left();
 			} 
 			
 			// Otherwise, the direction must be RIGHT.
 			else {
-				// If the right pointer of the parent is nullptr or is a skip link,
+				// If the right link of the parent is null or is a skip link,
 				// the right internal node does not exist so we insert a new internal node.
-				if (parent->get_right() == nullptr || parent->is_right_skip_link()) {
-					auto node = new node_type(prefix);
+				if (parent_node->get_right() == null_handle_ || parent_node->is_right_skip_link()) {
+					auto node = create_node(parent);
 					lss_.at(level_index)[prefix] = node;
-					parent->set_right(node);
+					parent_node->set_right(node);
 				}
 
-				// If the left pointer of the parent is nullptr, we must have created the parent
-				// in the last step. Then, the left pointer should become a skip link to the new 
+				// If the left link of the parent is null, we must have created the parent
+				// in the last step. Then, the left link should become a skip link to the new 
 				// leaf node. Also, if the parent already has a left skip link, then we need to
 				// update the left skip link if the new leaf has a lesser key, because the left
 				// skip link must always point to the smallest leaf in the subtree.
-				if ((parent->get_left() == nullptr) || 
-					(parent->is_left_skip_link() && key < parent->get_left()->key())) {
-					parent->set_left_skip_link(leaf);
+				if ((parent_node->get_left() == null_handle_) || 
+					(parent_node->is_left_skip_link() && key < get_leaf(parent_node->get_left())->key())) {
+					parent_node->set_left_skip_link(leaf);
 				}
 
 				// Set the parent to the right child because we traversed to the right.
-				parent = parent->get_right();
+				parent = parent_node->get_right();
 			}
 		}
 
 		// Link the last inserted node to the leaf nodes.
+		get_leaf(leaf)->set_parent(parent);
+		auto parent_node = get_node(parent);
 		auto direction = get_direction(key);
 		if (direction == left_) {
-			parent->set_left(leaf);
-			if (parent->get_right() == nullptr)
-				parent->set_right_skip_link(leaf);
+			parent_node->set_left(leaf);
+			if (parent_node->get_right() == null_handle_)
+				parent_node->set_right_skip_link(leaf);
 		} 
 		// Otherwise, the direction must be RIGHT.
 		else {
-			parent->set_right(leaf);
-			if (parent->get_left() == nullptr)
-				parent->set_left_skip_link(leaf);
+			parent_node->set_right(leaf);
+			if (parent_node->get_left() == null_handle_)
+				parent_node->set_left_skip_link(leaf);
 		}
 	}
 
+public:
 	/**
 	 * @brief Remove a key from the trie.
 	 * 
@@ -431,71 +966,70 @@ public:
 
 		// Get the leaf node that we are removing as well as the predecessor and successor nodes.
 		auto leaf = lss_.at(bit_length()).at(key);
-		auto pred = leaf->get_left();
-		auto succ = leaf->get_right();
+		auto pred = get_leaf(leaf)->get_left();
+		auto succ = get_leaf(leaf)->get_right();
 
 		// Remove the leaf node.
 		lss_.at(bit_length()).remove(key);
 		size_ -= 1;
 
 		// Update the linked list on the bottom layer.
-		if (pred != nullptr) 
-			pred->set_right(succ);
+		if (pred != null_handle_) 
+			get_leaf(pred)->set_right(succ);
 
-		if (succ != nullptr) 
-			succ->set_left(pred);
+		if (succ != null_handle_) 
+			get_leaf(succ)->set_left(pred);
 
-		// Remove internal nodes and update skip links.
-		// TODO: Include a parent pointer in the internal nodes to avoid hash table lookups.
+		// Walk up the trie through the parent links. Whether a node still has a child on
+		// either side is encoded in its own links, so the level search structures are only
+		// touched to erase prefixes that no longer exist.
+		auto parent = get_leaf(leaf)->get_parent();
+		bool removed_child = true;
 		for (int level = bit_length() - 1; level >= 0; --level) {
-			auto prefix = get_prefix(key, level);
+			auto parent_node = get_node(parent);
+			auto grandparent = parent_node->get_parent();
+			auto direction = get_direction(get_prefix(key, level + 1));
 
-			// Compute the prefix of the left and right children.
-			auto left_child_prefix = prefix << 1;
-			auto right_child_prefix = (prefix << 1) | 1;
-
-			// Check if the children are in the level search structure.
-			bool left_child_exists = lss_.at(level + 1).contains(left_child_prefix);
-			bool right_child_exists = lss_.at(level + 1).contains(right_child_prefix);
-
-			// If neither child has changed, do not change the parent.
-			if (left_child_exists && right_child_exists)
-				continue;
-
-			// Compute the parent.
-			auto parent = lss_.at(level).at(prefix);	
+			if (removed_child) {
+				// If the removed child was the only child, delete the parent as well.
+				bool sibling_exists = direction == left_ ? parent_node->has_right_child() : parent_node->has_left_child();
+				if (!sibling_exists) {
+					lss_.at(level).remove(get_prefix(key, level));
+					destroy_node(parent);
+					parent = grandparent;
+					continue;
+				}
 
-			// If neither child is in the level search structure, delete the parent.
-			if (!left_child_exists && !right_child_exists) {
-				delete parent;
-				lss_.at(level).remove(prefix);
-			} 
+				// Otherwise, the side of the removed child becomes a skip link to the nearest leaf
+				// in the remaining subtree.
+				if (direction == left_)
+					parent_node->set_left_skip_link(succ);
+				else
+					parent_node->set_right_skip_link(pred);
+				removed_child = false;
+			}
 
-			// Otherwise, only one child has been removed, update the skip links.
-			else {
-				// If the left child was removed, update the skip link.
-				if (!left_child_exists && (parent->get_left() == leaf || !parent->is_left_skip_link())) {
-					parent->set_left_skip_link(succ);
-				}
-				// Otherwise, if the right child was removed, update the skip link.
-				else if (!right_child_exists && (parent->get_right() == leaf || !parent->is_right_skip_link())) {
-					parent->set_right_skip_link(pred);
-				}
+			// A skip link on the other side of a surviving child may still point to the removed
+			// leaf, which was the smallest or largest leaf of that child.
+			else if (parent_node->is_left_skip_link() && parent_node->get_left() == leaf) {
+				parent_node->set_left_skip_link(succ);
 			}
+			else if (parent_node->is_right_skip_link() && parent_node->get_right() == leaf) {
+				parent_node->set_right_skip_link(pred);
+			}
+
+			parent = grandparent;
 		}
-		delete leaf;
+		destroy_leaf(leaf);
 	}
 
 	/**
-	 * @brief Destroy the XFastTrie object.
+	 * @brief Destroy the XFastTrie object. The allocators free the nodes.
 	 * 
 	 */
-	virtual ~XFastTrie() {
-		for (auto level : lss_)
-			for (auto key_and_node : level)
-				delete key_and_node.second;
-	}
+	virtual ~XFastTrie() {  }
 
 public:
-	template <typename, typename> friend class YFastTrie;
+	template <typename, typename, template <typename, typename> class, typename> friend class YFastTrie;
+	template <typename, typename, template <typename, typename> class> friend class ConcurrentYFastTrie;
 };
\ No newline at end of file
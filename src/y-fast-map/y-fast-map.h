@@ -0,0 +1,259 @@
+/**
+ * @file y-fast-map.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief YFastMap class template.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "../y-fast-trie/y-fast-trie.h"
+#include "../sorted-array-bucket/sorted-array-map-bucket.h"
+#include "../constants.h"
+#include <optional>
+#include <utility>
+
+/**
+ * @brief Ordered map on a bounded universe of keys, with the same time complexities as YFastTrie.
+ *
+ * The map is a YFastTrie whose buckets store each value inline next to its key, so the
+ * representatives, splits and merges are exactly those of the trie, and finding a value costs no
+ * more cache misses than finding its key. Values are constructed in place and are only ever moved
+ * when buckets are split or merged, so move-only value types are supported. Pointers to values
+ * are invalidated by any insert or erase.
+ *
+ * @tparam Key_ is the key type.
+ * @tparam Value_ is the value type.
+ * @tparam Map_ is the hash table type. See XFastTrie for the requirements.
+ */
+template <typename Key_, typename Value_, template <typename, typename> class Map_ = flat_map>
+class YFastMap {
+public:
+	using key_type = Key_;
+	using value_type = Value_;
+	using some_key_type = std::optional<key_type>;
+	using size_type = size_t;
+
+private:
+	using bucket_type = SortedArrayMapBucket<key_type, value_type>;
+	using trie_type = YFastTrie<key_type, bucket_type, Map_>;
+
+public:
+	using entry_type = typename bucket_type::entry_type;
+	using some_entry_type = typename bucket_type::some_entry_type;
+
+private:
+	trie_type trie_;
+
+public:
+	/**
+	 * @brief Get the bit length of the key type.
+	 *
+	 * @return constexpr size_type bit length of the key type.
+	 */
+	static constexpr size_type bit_length() noexcept {
+		return trie_type::bit_length();
+	}
+
+	/**
+	 * @brief Get the maximum key.
+	 *
+	 * @return constexpr key_type maximum key.
+	 */
+	static constexpr key_type upper_bound() noexcept {
+		return trie_type::upper_bound();
+	}
+
+	/**
+	 * @brief Get the minimum key.
+	 *
+	 * @return constexpr key_type minimum key.
+	 */
+	static constexpr key_type lower_bound() noexcept {
+		return trie_type::lower_bound();
+	}
+
+public:
+	/**
+	 * @brief Construct a new YFastMap object.
+	 *
+	 */
+	YFastMap() = default;
+
+	YFastMap(const YFastMap&) = delete;
+	YFastMap& operator=(const YFastMap&) = delete;
+
+	/**
+	 * @brief Get the number of entries in the map.
+	 *
+	 * @return size_type number of entries in the map.
+	 */
+	inline size_type size() const noexcept {
+		return trie_.size();
+	}
+
+	/**
+	 * @brief Check if the map is empty.
+	 *
+	 * @return true if the map is empty.
+	 * @return false if the map is not empty.
+	 */
+	inline bool empty() const noexcept {
+		return trie_.empty();
+	}
+
+	/**
+	 * @brief Check if the map contains a key.
+	 *
+	 * @param key to check if the map contains.
+	 * @return true if the map contains the key.
+	 * @return false if the map does not contain the key.
+	 */
+	bool contains(key_type key) const noexcept(NEX) {
+		return trie_.contains(key);
+	}
+
+	/**
+	 * @brief Find the value of a key.
+	 *
+	 * @param key to find the value of.
+	 * @return pointer to the value or nullptr if the map does not contain the key.
+	 */
+	value_type* find(key_type key) noexcept(NEX) {
+		auto partition = trie_.get_partition(key);
+		return partition == nullptr ? nullptr : partition->find(key);
+	}
+
+	/**
+	 * @brief Find the value of a key.
+	 *
+	 * @param key to find the value of.
+	 * @return pointer to the value or nullptr if the map does not contain the key.
+	 */
+	const value_type* find(key_type key) const noexcept(NEX) {
+		auto partition = trie_.get_partition(key);
+		return partition == nullptr ? nullptr : static_cast<const bucket_type*>(partition)->find(key);
+	}
+
+	/**
+	 * @brief Find the entry with the largest key that is strictly less than a key.
+	 *
+	 * @param key to find the predecessor of.
+	 * @return some_entry_type predecessor entry if the predecessor exists.
+	 * @return none_entry_type if the predecessor does not exist.
+	 */
+	some_entry_type predecessor_entry(key_type key) noexcept(NEX) {
+		auto partition = trie_.get_predecessor_partition(key, trie_.get_representative_node(key));
+		if (partition == nullptr) return some_entry_type();
+		return partition->predecessor_entry(key);
+	}
+
+	/**
+	 * @brief Find the entry with the smallest key that is strictly greater than a key.
+	 *
+	 * @param key to find the successor of.
+	 * @return some_entry_type successor entry if the successor exists.
+	 * @return none_entry_type if the successor does not exist.
+	 */
+	some_entry_type successor_entry(key_type key) noexcept(NEX) {
+		auto partition = trie_.get_successor_partition(key, trie_.get_representative_node(key));
+		if (partition == nullptr) return some_entry_type();
+		return partition->successor_entry(key);
+	}
+
+	/**
+	 * @brief Find the predecessor of a key.
+	 *
+	 * @param key to find the predecessor of.
+	 * @return some_key_type predecessor key if the predecessor exists.
+	 * @return none_key_type if the predecessor does not exist.
+	 */
+	some_key_type predecessor(key_type key) const noexcept(NEX) {
+		return trie_.predecessor(key);
+	}
+
+	/**
+	 * @brief Find the successor of a key.
+	 *
+	 * @param key to find the successor of.
+	 * @return some_key_type successor key if the successor exists.
+	 * @return none_key_type if the successor does not exist.
+	 */
+	some_key_type successor(key_type key) const noexcept(NEX) {
+		return trie_.successor(key);
+	}
+
+	/**
+	 * @brief Find the minimum key.
+	 *
+	 * @return some_key_type minimum key if map is not empty.
+	 * @return none_key_type if the map is empty.
+	 */
+	some_key_type min() const noexcept(NEX) {
+		return trie_.min();
+	}
+
+	/**
+	 * @brief Find the maximum key.
+	 *
+	 * @return some_key_type maximum key if map is not empty.
+	 * @return none_key_type if the map is empty.
+	 */
+	some_key_type max() const noexcept(NEX) {
+		return trie_.max();
+	}
+
+	/**
+	 * @brief Insert an entry, or assign the value of the entry if the map already contains the
+	 * key. The value is forwarded, so an rvalue is moved into the map without being copied.
+	 *
+	 * @param key of the entry.
+	 * @param value to insert or assign.
+	 * @return true if the entry was inserted.
+	 * @return false if the value was assigned.
+	 */
+	template <typename ValueArg_>
+	bool insert_or_assign(key_type key, ValueArg_&& value) noexcept(NEX) {
+		auto node = trie_.get_representative_node(key);
+		auto partition = trie_type::get_partition(node);
+		if (partition != nullptr) {
+			auto found = partition->find(key);
+			if (found != nullptr) {
+				*found = std::forward<ValueArg_>(value);
+				return false;
+			}
+		}
+		trie_.insert(key, node, std::forward<ValueArg_>(value));
+		return true;
+	}
+
+	/**
+	 * @brief Insert an entry whose value is constructed in place from some arguments. Nothing
+	 * happens if the map already contains the key.
+	 *
+	 * @param key of the entry.
+	 * @param args to forward to the value constructor.
+	 * @return true if the entry was inserted.
+	 * @return false if the map already contains the key.
+	 */
+	template <typename... Args>
+	bool try_emplace(key_type key, Args&&... args) noexcept(NEX) {
+		auto old_size = trie_.size();
+		trie_.insert(key, trie_.get_representative_node(key), std::forward<Args>(args)...);
+		return trie_.size() != old_size;
+	}
+
+	/**
+	 * @brief Erase the entry of a key and destroy its value.
+	 *
+	 * @param key to erase.
+	 * @return true if the entry was erased.
+	 * @return false if the map does not contain the key.
+	 */
+	bool erase(key_type key) noexcept(NEX) {
+		auto old_size = trie_.size();
+		trie_.remove(key);
+		return trie_.size() != old_size;
+	}
+};
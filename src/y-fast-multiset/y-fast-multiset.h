@@ -0,0 +1,220 @@
+/**
+ * @file y-fast-multiset.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief YFastMultiset class template.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "../y-fast-trie/y-fast-trie.h"
+#include "../sorted-array-bucket/sorted-array-map-bucket.h"
+#include "../constants.h"
+#include <optional>
+
+/**
+ * @brief Ordered multiset on a bounded universe of keys, with the same time complexities as
+ * YFastTrie.
+ *
+ * Each distinct key is stored once, next to a count of how many times it was inserted, so the
+ * buckets and the index are sized by the number of distinct keys no matter how many duplicates
+ * there are. Inserting a key that is already present only increments its count, and removing a
+ * key only decrements it until the last copy is removed.
+ *
+ * @tparam Key_ is the key type.
+ * @tparam Map_ is the hash table type. See XFastTrie for the requirements.
+ */
+template <typename Key_, template <typename, typename> class Map_ = flat_map>
+class YFastMultiset {
+public:
+	using key_type = Key_;
+	using some_key_type = std::optional<key_type>;
+	using size_type = size_t;
+
+private:
+	using bucket_type = SortedArrayMapBucket<key_type, size_type>;
+	using trie_type = YFastTrie<key_type, bucket_type, Map_>;
+
+private:
+	trie_type trie_;
+	size_type size_;
+
+public:
+	/**
+	 * @brief Get the bit length of the key type.
+	 *
+	 * @return constexpr size_type bit length of the key type.
+	 */
+	static constexpr size_type bit_length() noexcept {
+		return trie_type::bit_length();
+	}
+
+	/**
+	 * @brief Get the maximum key.
+	 *
+	 * @return constexpr key_type maximum key.
+	 */
+	static constexpr key_type upper_bound() noexcept {
+		return trie_type::upper_bound();
+	}
+
+	/**
+	 * @brief Get the minimum key.
+	 *
+	 * @return constexpr key_type minimum key.
+	 */
+	static constexpr key_type lower_bound() noexcept {
+		return trie_type::lower_bound();
+	}
+
+public:
+	/**
+	 * @brief Construct a new YFastMultiset object.
+	 *
+	 */
+	YFastMultiset() : size_(0) {  }
+
+	YFastMultiset(const YFastMultiset&) = delete;
+	YFastMultiset& operator=(const YFastMultiset&) = delete;
+
+	/**
+	 * @brief Get the number of keys in the multiset, counting every copy of a key.
+	 *
+	 * @return size_type number of keys in the multiset.
+	 */
+	inline size_type size() const noexcept {
+		return size_;
+	}
+
+	/**
+	 * @brief Get the number of distinct keys in the multiset.
+	 *
+	 * @return size_type number of distinct keys in the multiset.
+	 */
+	inline size_type distinct_size() const noexcept {
+		return trie_.size();
+	}
+
+	/**
+	 * @brief Check if the multiset is empty.
+	 *
+	 * @return true if the multiset is empty.
+	 * @return false if the multiset is not empty.
+	 */
+	inline bool empty() const noexcept {
+		return size_ == 0;
+	}
+
+	/**
+	 * @brief Count the copies of a key.
+	 *
+	 * @param key to count.
+	 * @return size_type number of copies of the key in the multiset.
+	 */
+	size_type count(key_type key) const noexcept(NEX) {
+		auto partition = trie_.get_partition(key);
+		if (partition == nullptr) return 0;
+		auto count = static_cast<const bucket_type*>(partition)->find(key);
+		return count == nullptr ? 0 : *count;
+	}
+
+	/**
+	 * @brief Check if the multiset contains a key.
+	 *
+	 * @param key to check if the multiset contains.
+	 * @return true if the multiset contains the key.
+	 * @return false if the multiset does not contain the key.
+	 */
+	bool contains(key_type key) const noexcept(NEX) {
+		return trie_.contains(key);
+	}
+
+	/**
+	 * @brief Find the largest key that is strictly less than a key.
+	 *
+	 * @param key to find the predecessor of.
+	 * @return some_key_type predecessor key if the predecessor exists.
+	 * @return none_key_type if the predecessor does not exist.
+	 */
+	some_key_type predecessor(key_type key) const noexcept(NEX) {
+		return trie_.predecessor(key);
+	}
+
+	/**
+	 * @brief Find the smallest key that is strictly greater than a key.
+	 *
+	 * @param key to find the successor of.
+	 * @return some_key_type successor key if the successor exists.
+	 * @return none_key_type if the successor does not exist.
+	 */
+	some_key_type successor(key_type key) const noexcept(NEX) {
+		return trie_.successor(key);
+	}
+
+	/**
+	 * @brief Find the minimum key.
+	 *
+	 * @return some_key_type minimum key if multiset is not empty.
+	 * @return none_key_type if the multiset is empty.
+	 */
+	some_key_type min() const noexcept(NEX) {
+		return trie_.min();
+	}
+
+	/**
+	 * @brief Find the maximum key.
+	 *
+	 * @return some_key_type maximum key if multiset is not empty.
+	 * @return none_key_type if the multiset is empty.
+	 */
+	some_key_type max() const noexcept(NEX) {
+		return trie_.max();
+	}
+
+	/**
+	 * @brief Insert a copy of a key.
+	 *
+	 * @param key to insert into the multiset.
+	 */
+	void insert(key_type key) noexcept(NEX) {
+		auto node = trie_.get_representative_node(key);
+		auto partition = trie_type::get_partition(node);
+		auto count = partition == nullptr ? nullptr : partition->find(key);
+
+		// A new key starts with a single copy.
+		if (count != nullptr) *count += 1;
+		else trie_.insert(key, node, size_type(1));
+		size_ += 1;
+	}
+
+	/**
+	 * @brief Remove a copy of a key. Nothing happens if the multiset does not contain the key.
+	 *
+	 * @param key to remove from the multiset.
+	 */
+	void remove(key_type key) noexcept(NEX) {
+		auto partition = trie_.get_partition(key);
+		auto count = partition == nullptr ? nullptr : partition->find(key);
+		if (count == nullptr) return;
+
+		// The key only leaves the trie with its last copy.
+		if (*count > 1) *count -= 1;
+		else trie_.remove(key);
+		size_ -= 1;
+	}
+
+	/**
+	 * @brief Remove every copy of a key.
+	 *
+	 * @param key to remove from the multiset.
+	 * @return size_type number of copies removed.
+	 */
+	size_type erase(key_type key) noexcept(NEX) {
+		auto count = this->count(key);
+		if (count == 0) return 0;
+		trie_.remove(key);
+		size_ -= count;
+		return count;
+	}
+};
@@ -9,8 +9,13 @@
 
 #pragma once 
 #include "../x-fast-trie/x-fast-trie.h"
+#include "../x-fast-trie/x-fast-trie-flat-map.h"
 #include "../x-fast-trie/x-fast-trie-map-wrapper.h"
 #include "../red-black-tree/red-black-tree.h"
+#include "../checksum/checksum.h"
+#include "../memory-breakdown/memory-breakdown.h"
+#include "../operation-stats/operation-stats.h"
+#include "../rank-tree/rank-tree.h"
 #include "../constants.h"
 #include <optional>
 #include <vector>
@@ -18,14 +23,34 @@
 #include <type_traits>
 #include <string>
 #include <array>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
 
 /**
  * @brief Data structure for fast dynamic ordered set operations on a bounded universe.
  * 
+ * Besides the ordered set operations, split, merge and build, a bucket type provides a
+ * bidirectional const_iterator over its keys with begin(), end() and lower_bound(key), which the
+ * iterators of the trie walk before following the leaf list of the index to the next bucket. It
+ * also provides rank(key) and select(index) in time logarithmic in the size of the bucket, and
+ * a static memory_per_key() giving the bytes that it allocates outside of itself for each key.
+ * 
+ * The instrumentation policy is passed on to the index, which keeps the counters of the trie, and
+ * the trie adds the splits and merges of its partitions. Buckets count their own work, so the
+ * rotations of RedBlackTree buckets are only counted by buckets that are instrumented themselves.
+ * 
  * @tparam Key_ is the key type.
  * @tparam Bucket_ is the bucket type.
+ * @tparam Map_ is the hash table type. See XFastTrie for the requirements.
+ * @tparam Stats_ is the instrumentation policy. See XFastTrie for the details.
  */
-template <typename Key_, typename Bucket_ = RedBlackTree<Key_>>
+template <typename Key_, typename Bucket_ = RedBlackTree<Key_>, 
+          template <typename, typename> class Map_ = flat_map, typename Stats_ = NoStats>
 class YFastTrie {
 public:
 	using key_type = Key_;
@@ -33,21 +58,45 @@ public:
 
 	using some_key_type = std::optional<key_type>;
 	using size_type = size_t;
+	using stats_type = Stats_;
 
 private:
-	using index_type = XFastTrie<key_type>;
-	using node_ptr = typename index_type::node_ptr;
-
 	using partition_type = Bucket_;
 	using partition_ptr = partition_type*;
 	using partition_ptrs = std::array<partition_ptr, 2>;
-	using partition_index_type = map_wrapper<key_type, partition_ptr>;
+
+	// Each representative leaf of the index carries a pointer to its partition.
+	using index_type = XFastTrie<key_type, Map_, NodeArena, partition_ptr, stats_type>;
+	using node_ptr = typename index_type::leaf_ptr;
+	using handle_type = typename index_type::handle_type;
 
 private:
 	index_type index_;
-	partition_index_type partitions_; 
 	size_type size_;
 
+	// Order statistics over the partitions, keyed by representative and weighted by partition
+	// size. Splits and merges update them along with the index, and inserting or removing a key
+	// reweights its partition. Tries that change partitions directly, like ConcurrentYFastTrie,
+	// let the weights drift and must not use rank or select.
+	using ranks_type = RankTree<key_type, partition_ptr>;
+	ranks_type ranks_;
+
+	/**
+	 * @brief Record of the changes that updates make to the index, in the order they were made,
+	 * and of the partitions they drop. A removed representative is recorded with a null
+	 * partition. ConcurrentYFastTrie replays the changes on its copy of the index and frees the
+	 * partitions once no reader can still reach them.
+	 *
+	 */
+	class journal_type {
+	public:
+		std::vector<std::pair<key_type, partition_ptr>> changes;
+		std::vector<partition_ptr> retired;
+	};
+
+	// Journal that updates record into, or nullptr if they are not recorded.
+	journal_type* journal_;
+
 private:
 	// Mask for computing representatives.
 	static constexpr key_type partition_mask_ = index_type::bit_length() - 1;
@@ -58,6 +107,12 @@ private:
 	// Minimum partition size.
 	static constexpr key_type min_partition_size_ = index_type::bit_length() / 2;
 
+	// Identifies a saved trie. It also rejects files written with the other byte order.
+	static constexpr uint32_t file_magic_ = UINT32_C(0x54534659);
+
+	// Version of the saved format, which must change whenever the format does.
+	static constexpr uint32_t file_version_ = 1;
+
 private:
 
 	/**
@@ -78,17 +133,38 @@ private:
 	 * @param representative node of the partition.
 	 * @return the partition of the node.
 	 */
-	inline partition_ptr get_partition(node_ptr node) const noexcept {
-		// We check to make sure the representative node exists and then we find the partition.
+	static inline partition_ptr get_partition(node_ptr node) noexcept {
+		// We check to make sure the representative node exists and then we read the partition
+		// stored in the leaf.
 		if (node == nullptr) return nullptr;
-		return partitions_.at(node->key());
+		return node->payload();
 	}
 
 	/**
-	 * @brief Get the partition from a representative node.
+	 * @brief Get the representative node of the partition before a partition.
 	 * 
-	 * @param representative node of the partition.
-	 * @return the partition of the node.
+	 * @param node is the representative node of the partition.
+	 * @return the representative node of the previous partition or nullptr if it does not exist.
+	 */
+	inline node_ptr get_left_node(node_ptr node) const noexcept {
+		return index_.get_previous_leaf(node);
+	}
+
+	/**
+	 * @brief Get the representative node of the partition after a partition.
+	 * 
+	 * @param node is the representative node of the partition.
+	 * @return the representative node of the next partition or nullptr if it does not exist.
+	 */
+	inline node_ptr get_right_node(node_ptr node) const noexcept {
+		return index_.get_next_leaf(node);
+	}
+
+	/**
+	 * @brief Get the partition that a key belongs to.
+	 * 
+	 * @param key to get the partition of.
+	 * @return the partition of the key.
 	 */
 	inline partition_ptr get_partition(key_type key) const noexcept {
 		auto node = get_representative_node(key);
@@ -101,9 +177,10 @@ private:
 	 * @param rep_key of the partition.
 	 * @param partition to insert.
 	 */
-	inline void insert_partition(key_type rep_key, partition_ptr partition) noexcept {
-		index_.insert(rep_key);
-		partitions_[rep_key] = partition;
+	inline void insert_partition(key_type rep_key, partition_ptr partition) noexcept(NEX) {
+		ranks_.insert(rep_key, partition, partition->size());
+		index_.emplace(rep_key, partition);
+		if (journal_ != nullptr) journal_->changes.emplace_back(rep_key, partition);
 	}
 
 	/**
@@ -111,7 +188,7 @@ private:
 	 * 
 	 * @param partition to insert.
 	 */
-	inline void insert_partition(partition_ptr partition) noexcept {
+	inline void insert_partition(partition_ptr partition) noexcept(NEX) {
 		auto rep_key = partition->max().value();
 		insert_partition(rep_key, partition);
 	}
@@ -121,9 +198,10 @@ private:
 	 * 
 	 * @param rep_key of the partition to remove.
 	 */
-	inline void remove_partition(key_type rep_key) noexcept {
+	inline void remove_partition(key_type rep_key) noexcept(NEX) {
+		ranks_.remove(rep_key);
 		index_.remove(rep_key);
-		partitions_.remove(rep_key);
+		if (journal_ != nullptr) journal_->changes.emplace_back(rep_key, nullptr);
 	}
 
 	/**
@@ -131,15 +209,26 @@ private:
 	 * 
 	 * @param representative node of the partition to remove.
 	 */
-	inline void remove_partition(node_ptr node) noexcept {
+	inline void remove_partition(node_ptr node) noexcept(NEX) {
 		remove_partition(node->key());
 	}
 
+	/**
+	 * @brief Delete a partition that is no longer in the index, or retire it if updates are
+	 * recorded.
+	 * 
+	 * @param partition to delete.
+	 */
+	inline void delete_partition(partition_ptr partition) noexcept(NEX) {
+		if (journal_ != nullptr) journal_->retired.push_back(partition);
+		else delete partition;
+	}
+
 	/**
 	 * @brief Insert a partition as the default.
 	 * 
 	 */
-	void insert_default_partition(partition_ptr partition) noexcept {
+	void insert_default_partition(partition_ptr partition) noexcept(NEX) {
 		insert_partition(upper_bound(), partition);
 	}
 
@@ -148,13 +237,341 @@ private:
 	 * 
 	 * @return the default partition.
 	 */
-	inline partition_ptr create_default_partition() noexcept {
+	inline partition_ptr create_default_partition() noexcept(NEX) {
 		auto partition = new partition_type();
 		insert_default_partition(partition);
 		return partition;
 	}
 
+	/**
+	 * @brief Build the order statistics over the partitions from their representative leaves.
+	 * 
+	 * @param leaves of the partitions in increasing order.
+	 */
+	void build_ranks(const std::vector<handle_type>& leaves) noexcept(NEX) {
+		std::vector<typename ranks_type::entry_type> entries;
+		entries.reserve(leaves.size());
+		for (auto handle : leaves) {
+			auto node = index_.get_leaf(handle);
+			entries.push_back({node->key(), get_partition(node), get_partition(node)->size()});
+		}
+		ranks_.assign(entries);
+	}
+
+	/**
+	 * @brief Build a partition from a range of strictly increasing keys.
+	 * 
+	 * @param neighbor is a partition whose resources the new partition shares, or nullptr.
+	 * @param first key of the range.
+	 * @param last key of the range, exclusive.
+	 * @return the new partition.
+	 */
+	template <typename Iterator_>
+	inline partition_ptr build_partition(partition_ptr neighbor, Iterator_ first, Iterator_ last) noexcept(NEX) {
+		if (neighbor == nullptr) return new partition_type(first, last);
+		return neighbor->build(first, last);
+	}
+
+	/**
+	 * @brief Write a value to a stream and add it to a checksum.
+	 * 
+	 * @param os is the stream to write to.
+	 * @param checksum of the bytes written so far.
+	 * @param data is the first value.
+	 * @param count is the number of values.
+	 */
+	template <typename Value_>
+	static inline void write_values(std::ostream& os, Checksum& checksum, const Value_* data, size_type count) {
+		checksum.update(data, count * sizeof(Value_));
+		os.write(reinterpret_cast<const char*>(data), count * sizeof(Value_));
+	}
+
+	/**
+	 * @brief Read a value from a stream and add it to a checksum.
+	 * 
+	 * @param is is the stream to read from.
+	 * @param checksum of the bytes read so far.
+	 * @param data is the first value.
+	 * @param count is the number of values.
+	 * @return true if every value was read.
+	 * @return false if the stream ended or failed.
+	 */
+	template <typename Value_>
+	static inline bool read_values(std::istream& is, Checksum& checksum, Value_* data, size_type count) {
+		is.read(reinterpret_cast<char*>(data), count * sizeof(Value_));
+		if (!is) return false;
+		checksum.update(data, count * sizeof(Value_));
+		return true;
+	}
+
+	/**
+	 * @brief Check if the trie contains a key, given the representative node of the key.
+	 * 
+	 * @param key to check if the trie contains.
+	 * @param node is the representative node of the key.
+	 * @return true if the trie contains the key.
+	 * @return false if the trie does not contain the key.
+	 */
+	bool contains(key_type key, node_ptr node) const noexcept(NEX) {
+		// Compute the partition that the key would belong to. If the partition exists and contains
+		// the key then the trie contains that key. Otherwise, the trie does not contain the key.
+		auto partition = get_partition(node);
+		return partition != nullptr && partition->contains(key);
+	}
+
+	/**
+	 * @brief Find the partition that holds the predecessor of a key, given the representative
+	 * node of the key.
+	 * 
+	 * @param key to find the predecessor of.
+	 * @param node is the representative node of the key.
+	 * @return the partition of the predecessor or nullptr if the predecessor does not exist.
+	 */
+	partition_ptr get_predecessor_partition(key_type key, node_ptr node) const noexcept(NEX) {
+		auto partition = get_partition(node);
+
+		// If the partition does not exist, then any key less than the given key cannot be in the
+		// trie. In other words, there are no possible predecessors. This also handles the case
+		// where the representative node does not exist because the partition does not exist, if
+		// and only if the representative node does not exist.
+		if (partition == nullptr) return nullptr;
+
+		// If the current partition does not contain the predecessor, then the predecessor must be 
+		// in the partition to the left. This happens when the key is the smallest value in the 
+		// partition because the predecessor cannot be in the partition. We also know that 
+		// the predecessor exists because we would have already returned if it didn't.
+		if (partition->min().value() >= key) {
+			// Compute the left representative node.
+			auto left_node = get_left_node(node);
+
+			// Make sure the left partition actually exists.
+			if (left_node == nullptr) return nullptr;
+
+			// Set the partition to the left partition.
+			partition = get_partition(left_node);
+		}
+
+		return partition;
+	}
+
+	/**
+	 * @brief Find the partition that holds the successor of a key, given the representative
+	 * node of the key.
+	 * 
+	 * @param key to find the successor of.
+	 * @param node is the representative node of the key.
+	 * @return the partition of the successor or nullptr if the successor does not exist.
+	 */
+	partition_ptr get_successor_partition(key_type key, node_ptr node) const noexcept(NEX) {
+		auto partition = get_partition(node);
+
+		// If the partition does not exist, then any key greater than the given key cannot be in the
+		// trie. In other words, there are no possible successors. This also handles the case
+		// where the representative node does not exist because the partition does not exist, if
+		// and only if the representative node does not exist.
+		if (partition == nullptr) return nullptr;
+
+		// If the current partition does not contain the successor, then the successor must be 
+		// in the partition to the right. This happens when the key is the smallest value in the 
+		// partition because the successor cannot be in the partition. We also know that 
+		// the successor exists because we would have already returned if it didn't.
+		if (partition->max().value() <= key) {
+			// Compute the right representative node.
+			auto right_node = get_right_node(node);
+
+			// Make sure the right partition actually exists.
+			if (right_node == nullptr) return nullptr;
+
+			// Set the partition to the right partition.
+			partition = get_partition(right_node);
+		}
+
+		return partition;
+	}
+
+	/**
+	 * @brief Find the predecessor of a key, given the representative node of the key.
+	 * 
+	 * @param key to find the predecessor of.
+	 * @param node is the representative node of the key.
+	 * @return some_key_type predecessor key if the predecessor exists. 
+	 * @return none_key_type if the predecessor does not exist.
+	 */
+	some_key_type predecessor(key_type key, node_ptr node) const noexcept(NEX) {
+		auto partition = get_predecessor_partition(key, node);
+		if (partition == nullptr) return some_key_type();
+		return partition->predecessor(key);
+	}
+
+	/**
+	 * @brief Find the successor of a key, given the representative node of the key.
+	 * 
+	 * @param key to find the successor of.
+	 * @param node is the representative node of the key.
+	 * @return some_key_type successor key if the successor exists.
+	 * @return none_key_type if the successor does not exist.
+	 */
+	some_key_type successor(key_type key, node_ptr node) const noexcept(NEX) { 
+		auto partition = get_successor_partition(key, node);
+		if (partition == nullptr) return some_key_type();
+		return partition->successor(key);
+	}
+
+	/**
+	 * @brief Insert a key into the trie, given the representative node of the key. Any extra
+	 * arguments are forwarded to the insert method of the partition, which lets buckets store a
+	 * value with each key.
+	 * 
+	 * @param key to insert into the trie.
+	 * @param node is the representative node of the key.
+	 * @param args to forward to the partition.
+	 */
+	template <typename... Args>
+	void insert(key_type key, node_ptr node, Args&&... args) noexcept(NEX) {
+		// Compute the partition that the key would belong to.
+		auto partition = !node ? create_default_partition() : get_partition(node);
+		auto rep_key = !node ? upper_bound() : node->key();
+
+		// Prevent double inserts.
+		if (partition->contains(key)) return;
+
+		// Insert the key into the partition.
+		partition->insert(key, std::forward<Args>(args)...);
+		ranks_.adjust(rep_key, 1);
+
+		// If the partition has exceeded the maximum size, then we must split the partition or we
+		// will be unable to meet the correct time complexity bounds.
+		if (partition->size() > max_partition_size_) {
+			// Check if the current partition is the default partition.
+			bool is_default = !node->get_right();
+
+			// Then, we remove the original partition from the trie.
+			remove_partition(node);
+
+			// Finally, we split the original partition and insert the new partitions.
+			index_.stats().count_split();
+			auto new_partitions = partition->split();
+			delete_partition(partition);
+			insert_partition(new_partitions[0]);
+
+			// The second partition might need to be inserted as the default.
+			if (is_default) insert_default_partition(new_partitions[1]);
+			else insert_partition(new_partitions[1]);
+    	}
+
+    	size_ += 1;
+	}
+
+	/**
+	 * @brief Answer a batch of queries. The representative nodes of each group of keys are found
+	 * with interleaved searches and the partitions of the group are prefetched before any of them
+	 * is searched.
+	 * 
+	 * @param keys to query.
+	 * @param count is the number of keys.
+	 * @param results receives the result of each query.
+	 * @param query computes the result of a query from the key and its representative node.
+	 */
+	template <typename Result_, typename Query_>
+	void query_batch(const key_type* keys, size_type count, Result_* results, Query_ query) const noexcept(NEX) {
+		node_ptr nodes[index_type::batch_size_];
+		for (size_type first = 0; first < count; first += index_type::batch_size_) {
+			auto group_size = std::min(index_type::batch_size_, count - first);
+			index_.get_inclusive_successor_nodes(keys + first, group_size, nodes);
+			for (size_type i = 0; i < group_size; ++i)
+				if (nodes[i] != nullptr) __builtin_prefetch(get_partition(nodes[i]));
+			for (size_type i = 0; i < group_size; ++i)
+				results[first + i] = query(keys[first + i], nodes[i]);
+		}
+	}
+
 public:
+	/**
+	 * @brief Bidirectional iterator over the keys of the trie in increasing order. It walks the
+	 * keys of a partition and then follows the leaf list of the index to the next partition, so
+	 * moving to the next key takes amortized constant time.
+	 * 
+	 */
+	class const_iterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = key_type;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const key_type*;
+		using reference = const key_type&;
+
+	private:
+		using partition_iterator = typename partition_type::const_iterator;
+
+	private:
+		const YFastTrie* trie_;
+		node_ptr node_;
+		partition_iterator it_;
+
+		/**
+		 * @brief Move to the first key of the partition of a representative node.
+		 * 
+		 * @param node is the representative node, or nullptr for the end of the trie.
+		 */
+		inline void enter_front(node_ptr node) noexcept(NEX) {
+			node_ = node;
+			it_ = node_ == nullptr ? partition_iterator() : get_partition(node_)->begin();
+		}
+
+		/**
+		 * @brief Move to the last key of the partition of a representative node.
+		 * 
+		 * @param node is the representative node.
+		 */
+		inline void enter_back(node_ptr node) noexcept(NEX) {
+			node_ = node;
+			it_ = get_partition(node_)->end();
+			--it_;
+		}
+
+	public:
+		/**
+		 * @brief Construct a new const_iterator object.
+		 * 
+		 * @param trie to iterate over.
+		 * @param node is the representative node of the current partition, or nullptr for the end.
+		 * @param it is the position in the current partition.
+		 */
+		const_iterator(const YFastTrie* trie = nullptr, node_ptr node = nullptr,
+		               partition_iterator it = partition_iterator())
+			: trie_(trie), node_(node), it_(it) {  }
+
+		inline reference operator*() const noexcept { return *it_; }
+		inline pointer operator->() const noexcept { return &*it_; }
+
+		inline const_iterator& operator++() noexcept(NEX) {
+			if (++it_ == get_partition(node_)->end())
+				enter_front(trie_->get_right_node(node_));
+			return *this;
+		}
+
+		inline const_iterator& operator--() noexcept(NEX) {
+			if (node_ == nullptr)
+				enter_back(trie_->index_.get_leaf_node(trie_->index_.max().value()));
+			else if (it_ == get_partition(node_)->begin())
+				enter_back(trie_->get_left_node(node_));
+			else
+				--it_;
+			return *this;
+		}
+
+		inline const_iterator operator++(int) noexcept(NEX) { auto it = *this; ++(*this); return it; }
+		inline const_iterator operator--(int) noexcept(NEX) { auto it = *this; --(*this); return it; }
+
+		inline bool operator==(const const_iterator& other) const noexcept {
+			return node_ == other.node_ && (node_ == nullptr || it_ == other.it_);
+		}
+
+		inline bool operator!=(const const_iterator& other) const noexcept {
+			return !(*this == other);
+		}
+	};
+
 	/**
 	 * @brief Find the maximum possible key.
 	 *
@@ -187,7 +604,52 @@ public:
 	 * @brief Construct a new YFastTrie object.
 	 * 
 	 */
-    YFastTrie() : size_(0) {  }
+    YFastTrie() : size_(0), journal_(nullptr) {  }
+
+	/**
+	 * @brief Construct a new YFastTrie object from a sorted range of keys in linear time. The
+	 * keys are cut directly into partitions of bit_length() keys and the index is built
+	 * bottom-up from the representatives.
+	 * 
+	 * @param first key of the range.
+	 * @param last key of the range, exclusive. Duplicate keys are ignored.
+	 */
+	template <typename Iterator_>
+	YFastTrie(Iterator_ first, Iterator_ last) : YFastTrie() {
+		// A partition is only cut once the keys after it fill a minimum sized partition, so the
+		// last partition is never smaller than the minimum unless the whole range is.
+		constexpr size_type cut_size = bit_length();
+		std::vector<key_type> keys;
+		keys.reserve(cut_size + min_partition_size_);
+
+		std::vector<handle_type> leaves;
+		partition_ptr partition = nullptr;
+		for (; first != last; ++first) {
+			key_type key = *first;
+			assert((keys.empty() || keys.back() <= key) && "Keys must be sorted.");
+			if (!keys.empty() && keys.back() == key) continue;
+
+			keys.push_back(key);
+			size_ += 1;
+			if (keys.size() < cut_size + min_partition_size_) continue;
+
+			partition = build_partition(partition, keys.begin(), keys.begin() + cut_size);
+			leaves.push_back(index_.create_leaf(partition->max().value(), partition));
+			keys.erase(keys.begin(), keys.begin() + cut_size);
+		}
+
+		// The remaining keys form the default partition.
+		if (!keys.empty()) {
+			partition = build_partition(partition, keys.begin(), keys.end());
+			leaves.push_back(index_.create_leaf(upper_bound(), partition));
+		}
+
+		index_.build_levels(leaves);
+		build_ranks(leaves);
+	}
+
+	YFastTrie(const YFastTrie&) = delete;
+	YFastTrie& operator=(const YFastTrie&) = delete;
 
 	/**
 	 * @brief Get the number of keys stored in the trie.
@@ -208,6 +670,48 @@ public:
 		return size_ == 0;
 	}
 
+	/**
+	 * @brief Get the heap memory of the trie by category. The memory of the partitions follows
+	 * from the number of partitions and keys, so this takes time linear in the bit length of the
+	 * keys rather than in the number of keys. Free nodes of allocators that are owned by the
+	 * partitions are not counted.
+	 * 
+	 * @return MemoryBreakdown memory of the index, the order statistics and the partitions.
+	 */
+	MemoryBreakdown memory_breakdown() const noexcept(NEX) {
+		auto breakdown = index_.memory_breakdown();
+		breakdown.tables += ranks_.memory_usage();
+		breakdown.partitions = index_.size() * sizeof(partition_type) + size_ * partition_type::memory_per_key();
+		return breakdown;
+	}
+
+	/**
+	 * @brief Get the heap memory of the trie.
+	 * 
+	 * @return size_type number of bytes allocated by the trie.
+	 */
+	size_type memory_usage() const noexcept(NEX) {
+		return memory_breakdown().total();
+	}
+
+	/**
+	 * @brief Get the work done by the operations on the trie since it was created or its counters
+	 * were last reset. Every counter is 0 unless the trie is instrumented with OperationStats.
+	 * 
+	 * @return OperationCounters snapshot of the counters.
+	 */
+	OperationCounters operation_counters() const noexcept {
+		return index_.operation_counters();
+	}
+
+	/**
+	 * @brief Set every operation counter to 0.
+	 * 
+	 */
+	void reset_operation_counters() noexcept {
+		index_.reset_operation_counters();
+	}
+
 	/**
 	 * @brief Check if the trie contains a key.
 	 * 
@@ -217,11 +721,7 @@ public:
 	 */
 	bool contains(key_type key) const noexcept(NEX) {
 		if (empty()) return false;
-		// Compute the partition that the key would belong to. If the partition exists and contains
-		// the key then the trie contains that key. Otherwise, the trie does not contain the key.
-		auto node = get_representative_node(key);
-		auto partition = get_partition(node);
-		return partition != nullptr && partition->contains(key);
+		return contains(key, get_representative_node(key));
 	}
 
 	/**
@@ -233,73 +733,348 @@ public:
 	 */
 	some_key_type predecessor(key_type key) const noexcept(NEX) {
 		if (empty()) return some_key_type();
+		return predecessor(key, get_representative_node(key));
+	}
 
-		// Compute the partition and representative node that the key would belong to.
+	/**
+	 * @brief Find the successor of a key.
+	 * 
+	 * @param key to find the successor of.
+	 * @return some_key_type successor key if the successor exists.
+	 * @return none_key_type if the successor does not exist.
+	 */
+	some_key_type successor(key_type key) const noexcept(NEX) { 
+		if (empty()) return some_key_type();
+		return successor(key, get_representative_node(key));
+	}
+
+	/**
+	 * @brief Check if the trie contains each key of a batch.
+	 * 
+	 * @param keys to check.
+	 * @param count is the number of keys.
+	 * @param results receives whether the trie contains each key.
+	 */
+	void contains_batch(const key_type* keys, size_type count, bool* results) const noexcept(NEX) {
+		if (empty()) {
+			std::fill(results, results + count, false);
+			return;
+		}
+		query_batch(keys, count, results, [this](key_type key, node_ptr node) {
+			return contains(key, node);
+		});
+	}
+
+	/**
+	 * @brief Find the predecessor of each key of a batch.
+	 * 
+	 * @param keys to find the predecessors of.
+	 * @param count is the number of keys.
+	 * @param results receives the predecessor of each key, or none if it does not exist.
+	 */
+	void predecessor_batch(const key_type* keys, size_type count, some_key_type* results) const noexcept(NEX) {
+		if (empty()) {
+			std::fill(results, results + count, some_key_type());
+			return;
+		}
+		query_batch(keys, count, results, [this](key_type key, node_ptr node) {
+			return predecessor(key, node);
+		});
+	}
+
+	/**
+	 * @brief Find the successor of each key of a batch.
+	 * 
+	 * @param keys to find the successors of.
+	 * @param count is the number of keys.
+	 * @param results receives the successor of each key, or none if it does not exist.
+	 */
+	void successor_batch(const key_type* keys, size_type count, some_key_type* results) const noexcept(NEX) {
+		if (empty()) {
+			std::fill(results, results + count, some_key_type());
+			return;
+		}
+		query_batch(keys, count, results, [this](key_type key, node_ptr node) {
+			return successor(key, node);
+		});
+	}
+
+	/**
+	 * @brief Get an iterator to the minimum key.
+	 * 
+	 * @return iterator to the minimum key, or the end if the trie is empty.
+	 */
+	const_iterator begin() const noexcept(NEX) {
+		if (empty()) return end();
+		auto node = index_.get_leaf_node(index_.min().value());
+		return const_iterator(this, node, get_partition(node)->begin());
+	}
+
+	/**
+	 * @brief Get an iterator past the maximum key.
+	 * 
+	 * @return iterator past the maximum key.
+	 */
+	const_iterator end() const noexcept {
+		return const_iterator(this);
+	}
+
+	/**
+	 * @brief Get an iterator to the smallest key that is greater than or equal to a key.
+	 * 
+	 * @param key to search for.
+	 * @return iterator to the key, or the end if no such key exists.
+	 */
+	const_iterator lower_bound(key_type key) const noexcept(NEX) {
+		if (empty()) return end();
+
+		// The partition of the key holds the bound unless every key of the partition is less
+		// than the key, in which case the bound is the first key of the next partition.
 		auto node = get_representative_node(key);
+		if (node == nullptr) return end();
 		auto partition = get_partition(node);
+		auto it = partition->lower_bound(key);
+		if (it != partition->end()) return const_iterator(this, node, it);
 
-		// If the partition does not exist, then any key less than the given key cannot be in the
-		// trie. In other words, there are no possible predecessors. This also handles the case
-		// where the representative node does not exist because the partition does not exist, if
-		// and only if the representative node does not exist.
-		if (partition == nullptr) return some_key_type();
+		node = get_right_node(node);
+		if (node == nullptr) return end();
+		return const_iterator(this, node, get_partition(node)->begin());
+	}
 
-		// If the current partition does not contain the predecessor, then the predecessor must be 
-		// in the partition to the left. This happens when the key is the smallest value in the 
-		// partition because the predecessor cannot be in the partition. We also know that 
-		// the predecessor exists because we would have already returned if it didn't.
-		if (partition->min().value() >= key) {
-			// Compute the left representative node.
-			auto left_node = node->get_left();
+	/**
+	 * @brief Get an iterator to the smallest key that is strictly greater than a key.
+	 * 
+	 * @param key to search for.
+	 * @return iterator to the key, or the end if no such key exists.
+	 */
+	const_iterator upper_bound(key_type key) const noexcept(NEX) {
+		if (key == upper_bound()) return end();
+		return lower_bound(static_cast<key_type>(key + 1));
+	}
 
-			// Make sure the left partition actually exists.
-			if (left_node == nullptr) return some_key_type();
+	/**
+	 * @brief Call a function on every key in a closed range, in increasing order. The low end
+	 * of the range is located once and the keys are then streamed partition by partition.
+	 * 
+	 * @param low is the smallest key of the range.
+	 * @param high is the largest key of the range.
+	 * @param function to call with each key.
+	 */
+	template <typename Function_>
+	void for_each_in_range(key_type low, key_type high, Function_ function) const noexcept(NEX) {
+		if (empty() || low > high) return;
 
-			// Set the partition to the left partition.
-			partition = get_partition(left_node);
+		auto node = get_representative_node(low);
+		if (node == nullptr) return;
+		auto partition = get_partition(node);
+		auto it = partition->lower_bound(low);
+		while (true) {
+			for (auto end = partition->end(); it != end; ++it) {
+				if (*it > high) return;
+				function(*it);
+			}
+
+			// Every key of the partition was in the range, so move to the next partition.
+			node = get_right_node(node);
+			if (node == nullptr) return;
+			partition = get_partition(node);
+			it = partition->begin();
 		}
+	}
 
-		// Compute the predecessor.
-		return partition->predecessor(key);
+	/**
+	 * @brief Copy every key in a closed range to an output iterator, in increasing order.
+	 * 
+	 * @param low is the smallest key of the range.
+	 * @param high is the largest key of the range.
+	 * @param out is the output iterator.
+	 * @return the output iterator past the last copied key.
+	 */
+	template <typename OutputIterator_>
+	OutputIterator_ range(key_type low, key_type high, OutputIterator_ out) const noexcept(NEX) {
+		for_each_in_range(low, high, [&out](key_type key) {
+			*out = key;
+			++out;
+		});
+		return out;
 	}
 
 	/**
-	 * @brief Find the successor of a key.
+	 * @brief Count the keys in a closed range. Only the partitions at either end of the range
+	 * are scanned, since every partition in between is counted from its size.
 	 * 
-	 * @param key to find the successor of.
-	 * @return some_key_type successor key if the successor exists.
-	 * @return none_key_type if the successor does not exist.
+	 * @param low is the smallest key of the range.
+	 * @param high is the largest key of the range.
+	 * @return the number of keys in the range.
 	 */
-	some_key_type successor(key_type key) const noexcept(NEX) { 
-		if (empty()) return some_key_type();
+	size_type count_range(key_type low, key_type high) const noexcept(NEX) {
+		if (empty() || low > high) return 0;
 
-		// Compute the partition and representative node that the key would belong to.
-		auto node = get_representative_node(key);
+		auto node = get_representative_node(low);
+		if (node == nullptr) return 0;
+
+		// Scan the partition of the low end of the range.
+		size_type count = 0;
 		auto partition = get_partition(node);
+		for (auto it = partition->lower_bound(low), end = partition->end(); it != end; ++it) {
+			if (*it > high) return count;
+			count += 1;
+		}
 
-		// If the partition does not exist, then any key greater than the given key cannot be in the
-		// trie. In other words, there are no possible successors. This also handles the case
-		// where the representative node does not exist because the partition does not exist, if
-		// and only if the representative node does not exist.
-		if (partition == nullptr) return some_key_type();
+		// The keys of the following partitions are all greater than the low end of the range,
+		// and no key of a partition is greater than its representative. So a partition whose
+		// representative is in the range lies entirely in the range.
+		for (node = get_right_node(node); node != nullptr; node = get_right_node(node)) {
+			partition = get_partition(node);
+			if (node->key() <= high) {
+				count += partition->size();
+				continue;
+			}
 
-		// If the current partition does not contain the successor, then the successor must be 
-		// in the partition to the right. This happens when the key is the smallest value in the 
-		// partition because the successor cannot be in the partition. We also know that 
-		// the successor exists because we would have already returned if it didn't.
-		if (partition->max().value() <= key) {
-			// Compute the right representative node.
-			auto right_node = node->get_right();
+			// Scan the partition of the high end of the range.
+			for (auto it = partition->begin(), end = partition->end(); it != end && *it <= high; ++it)
+				count += 1;
+			break;
+		}
+		return count;
+	}
 
-			// Make sure the right partition actually exists.
-			if (right_node == nullptr) return some_key_type();
+	/**
+	 * @brief Count the keys strictly less than a key in time logarithmic in the number of
+	 * partitions and the size of a partition.
+	 * 
+	 * @param key to rank.
+	 * @return the number of keys less than the key.
+	 */
+	size_type rank(key_type key) const noexcept(NEX) {
+		if (empty()) return 0;
 
-			// Set the partition to the right partition.
-			partition = get_partition(right_node);
+		// The keys of every partition before the partition of the key are less than the key, and
+		// the keys of every partition after it are greater.
+		auto node = get_representative_node(key);
+		if (node == nullptr) return size_;
+		return ranks_.weight_before(node->key()) + get_partition(node)->rank(key);
+	}
+
+	/**
+	 * @brief Find the key with a given index in increasing order in time logarithmic in the
+	 * number of partitions and the size of a partition.
+	 * 
+	 * @param index of the key, starting from 0.
+	 * @return some_key_type key if the index is less than the size of the trie.
+	 * @return none_key_type if the index is out of range.
+	 */
+	some_key_type select(size_type index) const noexcept(NEX) {
+		if (index >= size_) return some_key_type();
+		auto partition_and_index = ranks_.select(index);
+		return partition_and_index.first->select(partition_and_index.second);
+	}
+
+	/**
+	 * @brief Save the keys of the trie to a binary stream in time linear in the size of the trie.
+	 * 
+	 * The keys are written bucket by bucket in increasing order, after a header with the format
+	 * version, the key length and the number of keys and buckets, and before a checksum of
+	 * everything written. Values are written in the byte order of the machine. The stream must be
+	 * opened in binary mode and checked for errors afterwards.
+	 * 
+	 * @param os is the stream to save the trie to.
+	 */
+	void save(std::ostream& os) const {
+		Checksum checksum;
+		uint32_t header[4] = {file_magic_, file_version_, static_cast<uint32_t>(bit_length()), 0};
+		uint64_t counts[2] = {size_, index_.size()};
+		write_values(os, checksum, header, 4);
+		write_values(os, checksum, counts, 2);
+
+		std::vector<key_type> keys;
+		keys.reserve(max_partition_size_);
+		if (!empty()) {
+			for (auto node = index_.get_leaf_node(index_.min().value()); node != nullptr; node = get_right_node(node)) {
+				auto partition = get_partition(node);
+				keys.assign(partition->begin(), partition->end());
+				uint32_t count = static_cast<uint32_t>(keys.size());
+				write_values(os, checksum, &count, 1);
+				write_values(os, checksum, keys.data(), keys.size());
+			}
 		}
 
-		// Compute the successor.
-		return partition->successor(key);
+		auto value = checksum.value();
+		os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+	/**
+	 * @brief Load keys saved by save into an empty trie in time linear in the number of keys.
+	 * 
+	 * The saved buckets are rebuilt directly from their sorted keys and the index is built
+	 * bottom-up from their representatives, so no key is inserted one at a time and loading costs
+	 * about as much as the range constructor. The saved trie may have used another bucket type,
+	 * but must have used the same key type. Nothing is loaded if the header does not match, the stream
+	 * ends early, the keys are not strictly increasing or the checksum does not match.
+	 * 
+	 * @param is is the stream to load the trie from, opened in binary mode.
+	 * @return true if the trie was loaded.
+	 * @return false if the stream does not hold a valid trie, in which case the trie stays empty.
+	 */
+	bool load(std::istream& is) {
+		assert(empty() && "Cannot load into a non-empty trie.");
+
+		Checksum checksum;
+		uint32_t header[4];
+		uint64_t counts[2];
+		if (!read_values(is, checksum, header, 4) || !read_values(is, checksum, counts, 2)) return false;
+		if (header[0] != file_magic_ || header[1] != file_version_ || header[2] != bit_length()) return false;
+		if (counts[1] > counts[0]) return false;
+
+		// The partitions are only added to the index once the checksum matches, so that a bad
+		// stream leaves the trie untouched.
+		std::vector<partition_ptr> partitions;
+		std::vector<key_type> keys;
+		keys.reserve(max_partition_size_);
+		some_key_type last_key;
+		uint64_t key_count = 0;
+		bool valid = true;
+		for (uint64_t i = 0; i < counts[1] && valid; ++i) {
+			uint32_t count;
+			valid = read_values(is, checksum, &count, 1) && count > 0 && count <= max_partition_size_;
+			if (!valid) break;
+
+			keys.resize(count);
+			valid = read_values(is, checksum, keys.data(), count);
+			for (uint32_t j = 0; j < count && valid; ++j) {
+				valid = !last_key || last_key.value() < keys[j];
+				last_key = keys[j];
+			}
+			if (!valid) break;
+
+			auto neighbor = partitions.empty() ? nullptr : partitions.back();
+			partitions.push_back(build_partition(neighbor, keys.begin(), keys.end()));
+			key_count += count;
+		}
+
+		uint64_t value = 0;
+		if (valid) {
+			is.read(reinterpret_cast<char*>(&value), sizeof(value));
+			valid = is && value == checksum.value() && key_count == counts[0];
+		}
+		if (!valid) {
+			for (auto partition : partitions)
+				delete partition;
+			return false;
+		}
+
+		// Every partition but the last is represented by its maximum, and the last partition is
+		// the default partition.
+		std::vector<handle_type> leaves;
+		leaves.reserve(partitions.size());
+		for (size_type i = 0; i < partitions.size(); ++i) {
+			auto rep_key = i + 1 < partitions.size() ? partitions[i]->max().value() : upper_bound();
+			leaves.push_back(index_.create_leaf(rep_key, partitions[i]));
+		}
+		index_.build_levels(leaves);
+		build_ranks(leaves);
+		size_ = key_count;
+		return true;
 	}
 
 	/**
@@ -332,35 +1107,7 @@ public:
 	 * @param key to insert into the trie.
 	 */
 	void insert(key_type key) noexcept(NEX) {
-		// Compute the partition and representative node that the key would belong to.
-		auto node = get_representative_node(key);
-		auto partition = !node ? create_default_partition() : get_partition(node);
-
-		// Prevent double inserts.
-		if (partition->contains(key)) return;
-
-		// Insert the key into the partition.
-		partition->insert(key);
-
-		// If the partition has exceeded the maximum size, then we must split the partition or we
-		// will be unable to meet the correct time complexity bounds.
-		if (partition->size() > max_partition_size_) {
-			// Check if the current partition is the default partition.
-			bool is_default = !node->get_right();
-
-			// Then, we remove the original partition from the trie.
-			remove_partition(node);
-
-			// Finally, we split the original partition and insert the new partitions.
-			auto new_partitions = partition->split();
-			insert_partition(new_partitions[0]);
-
-			// The second partition might need to be inserted as the default.
-			if (is_default) insert_default_partition(new_partitions[1]);
-			else insert_partition(new_partitions[1]);
-    	}
-
-    	size_ += 1;
+		insert(key, get_representative_node(key));
 	}
 
 	/**
@@ -381,25 +1128,29 @@ public:
 
 		// Remove the key from the partition.
 		partition->remove(key);
+		ranks_.adjust(node->key(), -1);
 		
 		// If the partition is empty, delete it.
-		if (partition->empty()) 
+		if (partition->empty()) {
 			remove_partition(node);
+			delete_partition(partition);
+		}
 		
 		// Otherwise, if the partition is below the minimum size and we can merge it, do so.
-		else if (partition->size() < min_partition_size_ && partitions_.size() > 1) {
+		else if (partition->size() < min_partition_size_ && index_.size() > 1) {
 
 			// Compute the two representatives of the partitions to merge. The particular choice 
 			// does not matter, as long as we get two valid partitions to merge.
 			auto left_node  = node;
-			auto right_node = node->get_right() ? node->get_right() : node->get_left();
+			auto right_node = node->get_right() ? get_right_node(node) : get_left_node(node);
 			
 			// Ensure that the left partition has keys that are < the right partition.
 			if (left_node->key() > right_node->key())
 				std::swap(left_node, right_node);
 
-			// Check if the current partition is the default partition.
-			bool is_default = !node->get_right();
+			// Check if the right partition is the default partition. The merged partition must
+			// then become the default, even if the current partition is not the default.
+			bool is_default = !right_node->get_right();
 						
 			// Get the original partitions from the trie.
 			auto left_partition = get_partition(left_node);
@@ -410,12 +1161,17 @@ public:
 			remove_partition(right_node);
 
 			// Merge the two original partitions.
+			index_.stats().count_merge();
 			auto merged_partition = left_partition->merge(left_partition, right_partition);
+			delete_partition(left_partition);
+			delete_partition(right_partition);
 
 			// If the new merged partition exceeds the maximum size, we have to split it.
 			if (merged_partition->size() > max_partition_size_) {
 				// Split the partition and insert the new partitions.
+				index_.stats().count_split();
 				auto new_partitions = merged_partition->split();
+				delete_partition(merged_partition);
 				
 				// Finally, we split the original partition and insert the new partitions.
 				insert_partition(new_partitions[0]);
@@ -435,5 +1191,17 @@ public:
 		size_ -= 1;
 	}
 
-	virtual ~YFastTrie() = default;
+	/**
+	 * @brief Destroy the YFastTrie object.
+	 * 
+	 */
+	virtual ~YFastTrie() {
+		for (auto& key_and_leaf : index_.lss_.at(bit_length()))
+			delete get_partition(index_.get_leaf(key_and_leaf.second));
+	}
+
+public:
+	template <typename, typename, template <typename, typename> class> friend class ConcurrentYFastTrie;
+	template <typename, typename, template <typename, typename> class> friend class YFastMap;
+	template <typename, template <typename, typename> class> friend class YFastMultiset;
 };
\ No newline at end of file
@@ -0,0 +1,37 @@
+/**
+ * @file test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/concurrent-y-fast-trie/concurrent-y-fast-trie.h"
+#include "../../src/red-black-tree/red-black-tree.h"
+
+template <typename Key_>
+using RedBlackConcurrentYFastTrie = ConcurrentYFastTrie<Key_, RedBlackTree<Key_, SynchronizedNodePool>>;
+
+DEFINE_SIZE_TESTS(ConcurrentYFastTrie);
+DEFINE_CONTAINS_TESTS(ConcurrentYFastTrie);
+DEFINE_PREDECESSOR_TESTS(ConcurrentYFastTrie);
+DEFINE_SUCCESSOR_TESTS(ConcurrentYFastTrie);
+DEFINE_MIN_TESTS(ConcurrentYFastTrie);
+DEFINE_MAX_TESTS(ConcurrentYFastTrie);
+DEFINE_INSERT_TESTS(ConcurrentYFastTrie);
+DEFINE_REMOVE_TESTS(ConcurrentYFastTrie);
+DEFINE_BULK_LOAD_TESTS(ConcurrentYFastTrie);
+DEFINE_CONCURRENCY_TESTS(ConcurrentYFastTrie);
+
+DEFINE_SIZE_TESTS(RedBlackConcurrentYFastTrie);
+DEFINE_CONTAINS_TESTS(RedBlackConcurrentYFastTrie);
+DEFINE_PREDECESSOR_TESTS(RedBlackConcurrentYFastTrie);
+DEFINE_SUCCESSOR_TESTS(RedBlackConcurrentYFastTrie);
+DEFINE_MIN_TESTS(RedBlackConcurrentYFastTrie);
+DEFINE_MAX_TESTS(RedBlackConcurrentYFastTrie);
+DEFINE_INSERT_TESTS(RedBlackConcurrentYFastTrie);
+DEFINE_REMOVE_TESTS(RedBlackConcurrentYFastTrie);
+DEFINE_BULK_LOAD_TESTS(RedBlackConcurrentYFastTrie);
+DEFINE_CONCURRENCY_TESTS(RedBlackConcurrentYFastTrie);
+TEST_MAIN();
\ No newline at end of file
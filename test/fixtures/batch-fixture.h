@@ -0,0 +1,97 @@
+/**
+ * @file batch-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for the batch operations.
+ * @version 1.0
+ * @date 2026-10-16
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include <vector>
+#include <random>
+#include <optional>
+#include <memory>
+
+template <typename Obj_>
+class BatchFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    /**
+     * @brief Generate queries that cover the stored keys, their neighbours, random keys and both
+     * bounds. The number of queries is not a multiple of the batch group size.
+     * 
+     * @param keys that are stored.
+     * @return the queries.
+     */
+    std::vector<key_type> queries(const std::vector<key_type>& keys) {
+        std::mt19937_64 mte(1);
+        std::uniform_int_distribution<uint64_t> dist(Obj_::lower_bound(), Obj_::upper_bound());
+        std::vector<key_type> queries{Obj_::lower_bound(), Obj_::upper_bound()};
+        for (auto key : keys) {
+            queries.push_back(key);
+            queries.push_back(key + 1);
+            queries.push_back(static_cast<key_type>(dist(mte)));
+        }
+        queries.push_back(Obj_::upper_bound() - 1);
+        return queries;
+    }
+
+    /**
+     * @brief Check every batch operation against the single key operations.
+     * 
+     * @param queries to check.
+     */
+    void check_batches(const std::vector<key_type>& queries) {
+        auto count = queries.size();
+        std::unique_ptr<bool[]> contains(new bool[count]);
+        std::vector<std::optional<key_type>> predecessors(count), successors(count);
+
+        this->obj_.contains_batch(queries.data(), count, contains.get());
+        this->obj_.predecessor_batch(queries.data(), count, predecessors.data());
+        this->obj_.successor_batch(queries.data(), count, successors.data());
+
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(contains[i], this->obj_.contains(queries[i]));
+            EXPECT_EQ(predecessors[i], this->obj_.predecessor(queries[i]));
+            EXPECT_EQ(successors[i], this->obj_.successor(queries[i]));
+        }
+    }
+};
+
+TYPED_TEST_SUITE_P(BatchFixture);
+
+TYPED_TEST_P(BatchFixture, BatchEmpty) {
+    std::vector<typename TestFixture::key_type> keys;
+    this->check_batches(this->queries(keys));
+}
+
+TYPED_TEST_P(BatchFixture, BatchNoKeys) {
+    this->obj_.insert(this->obj_.lower_bound());
+    this->obj_.contains_batch(nullptr, 0, nullptr);
+    this->obj_.predecessor_batch(nullptr, 0, nullptr);
+    this->obj_.successor_batch(nullptr, 0, nullptr);
+}
+
+TYPED_TEST_P(BatchFixture, BatchSomeKeys) {
+    using key_type = typename TypeParam::key_type;
+
+    std::mt19937_64 mte;
+    std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+
+    std::vector<key_type> keys;
+    for (int insert_count = 0; insert_count < MAX_KEYS; ++insert_count) {
+        auto key = static_cast<key_type>(dist(mte));
+        this->obj_.insert(key);
+        keys.push_back(key);
+    }
+
+    this->check_batches(this->queries(keys));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(BatchFixture,
+    BatchEmpty, BatchNoKeys, BatchSomeKeys);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BatchFixture);
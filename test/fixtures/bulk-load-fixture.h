@@ -0,0 +1,138 @@
+/**
+ * @file bulk-load-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for construction from a sorted range.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include <vector>
+#include <random>
+#include <algorithm>
+
+template <typename Obj_>
+class BulkLoadFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    /**
+     * @brief Check a bulk loaded object against the object built by inserting the same keys.
+     * 
+     * @param obj that was bulk loaded.
+     * @param keys that were loaded.
+     */
+    void check_against_inserts(const Obj_& obj, const std::vector<key_type>& keys) {
+        for (auto key : keys)
+            this->obj_.insert(key);
+
+        EXPECT_EQ(obj.size(), this->obj_.size());
+        EXPECT_EQ(obj.min(), this->obj_.min());
+        EXPECT_EQ(obj.max(), this->obj_.max());
+
+        std::vector<key_type> queries{Obj_::lower_bound(), Obj_::upper_bound()};
+        for (auto key : keys) {
+            queries.push_back(key - 1);
+            queries.push_back(key);
+            queries.push_back(key + 1);
+        }
+        for (auto query : queries) {
+            EXPECT_EQ(obj.contains(query), this->obj_.contains(query));
+            EXPECT_EQ(obj.predecessor(query), this->obj_.predecessor(query));
+            EXPECT_EQ(obj.successor(query), this->obj_.successor(query));
+        }
+    }
+};
+
+TYPED_TEST_SUITE_P(BulkLoadFixture);
+
+TYPED_TEST_P(BulkLoadFixture, BulkLoadNoKeys) {
+    std::vector<typename TestFixture::key_type> keys;
+    TypeParam obj(keys.begin(), keys.end());
+    EXPECT_TRUE(obj.empty());
+    EXPECT_FALSE(obj.min().has_value());
+    EXPECT_FALSE(obj.contains(TypeParam::upper_bound()));
+}
+
+TYPED_TEST_P(BulkLoadFixture, BulkLoadEverySize) {
+    using key_type = typename TypeParam::key_type;
+
+    // Cover every way the range can be cut into partitions, including a range ending at the
+    // upper bound.
+    for (size_t size = 1; size <= 4 * TypeParam::bit_length(); ++size) {
+        std::vector<key_type> keys;
+        for (size_t i = 0; i < size; ++i)
+            keys.push_back(static_cast<key_type>(TypeParam::upper_bound() - 2 * (size - i - 1)));
+
+        TypeParam obj(keys.begin(), keys.end());
+        ASSERT_EQ(obj.size(), size);
+        for (auto key : keys)
+            ASSERT_TRUE(obj.contains(key));
+        ASSERT_EQ(obj.max(), TypeParam::upper_bound());
+
+        // The loaded object must stay valid under updates, which rebalance trees of every size.
+        for (size_t i = 0; i < std::min<size_t>(size, 4); ++i)
+            obj.insert(static_cast<key_type>(keys[i] - 1));
+        ASSERT_EQ(obj.size(), size + std::min<size_t>(size, 4));
+        for (size_t i = 0; i < std::min<size_t>(size, 4); ++i) {
+            obj.remove(static_cast<key_type>(keys[i] - 1));
+            ASSERT_FALSE(obj.contains(static_cast<key_type>(keys[i] - 1)));
+        }
+        obj.remove(keys.back());
+        ASSERT_EQ(obj.size(), size - 1);
+        for (size_t i = 0; i + 1 < size; ++i)
+            ASSERT_TRUE(obj.contains(keys[i]));
+    }
+}
+
+TYPED_TEST_P(BulkLoadFixture, BulkLoadSomeKeys) {
+    using key_type = typename TypeParam::key_type;
+
+    std::mt19937_64 mte;
+    std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+
+    // Duplicate keys are allowed in the range.
+    std::vector<key_type> keys{TypeParam::lower_bound()};
+    for (int insert_count = 0; insert_count < MAX_KEYS; ++insert_count)
+        keys.push_back(static_cast<key_type>(dist(mte)));
+    std::sort(keys.begin(), keys.end());
+
+    TypeParam obj(keys.begin(), keys.end());
+    this->check_against_inserts(obj, keys);
+}
+
+TYPED_TEST_P(BulkLoadFixture, BulkLoadThenUpdate) {
+    using key_type = typename TypeParam::key_type;
+
+    std::mt19937_64 mte;
+    std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+
+    std::vector<key_type> keys;
+    for (int insert_count = 0; insert_count < MAX_KEYS; ++insert_count)
+        keys.push_back(static_cast<key_type>(dist(mte)));
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    // Loaded partitions must split and merge like inserted ones.
+    TypeParam obj(keys.begin(), keys.end());
+    std::shuffle(keys.begin(), keys.end(), mte);
+    auto half = keys.begin() + keys.size() / 2;
+    for (auto it = keys.begin(); it != half; ++it) {
+        obj.remove(*it);
+        EXPECT_FALSE(obj.contains(*it));
+    }
+    for (auto it = half; it != keys.end(); ++it)
+        EXPECT_TRUE(obj.contains(*it));
+    for (auto it = keys.begin(); it != half; ++it)
+        obj.insert(*it);
+    EXPECT_EQ(obj.size(), keys.size());
+
+    this->check_against_inserts(obj, keys);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(BulkLoadFixture,
+    BulkLoadNoKeys, BulkLoadEverySize, BulkLoadSomeKeys, BulkLoadThenUpdate);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BulkLoadFixture);
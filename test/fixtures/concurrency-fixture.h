@@ -0,0 +1,160 @@
+/**
+ * @file concurrency-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for concurrent access.
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include <set>
+#include <vector>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+
+// Number of threads to run at once.
+constexpr int THREAD_COUNT = 8;
+
+template <typename Obj_>
+class ConcurrencyFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    /**
+     * @brief Get the key with a given index. The keys are spread over the universe and the key
+     * after each key is never another indexed key.
+     *
+     * @param index of the key.
+     * @return the key.
+     */
+    static key_type indexed_key(uint64_t index) {
+        uint64_t step = std::max<uint64_t>(2, Obj_::upper_bound() / (2 * MAX_KEYS));
+        return static_cast<key_type>(index * step);
+    }
+
+    /**
+     * @brief Get the number of indexed keys.
+     *
+     * @return the number of indexed keys.
+     */
+    static uint64_t key_count() {
+        return std::min<uint64_t>(2 * MAX_KEYS, Obj_::upper_bound() / 2);
+    }
+
+    /**
+     * @brief Run a function on many threads at once.
+     *
+     * @param f is called with the index of each thread.
+     */
+    template <typename Function_>
+    static void run_threads(Function_ f) {
+        std::vector<std::thread> threads;
+        for (int thread = 0; thread < THREAD_COUNT; ++thread)
+            threads.emplace_back(f, thread);
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    /**
+     * @brief Check that the object contains exactly the expected keys.
+     *
+     * @param keys are the expected keys.
+     */
+    void check_keys(const std::set<key_type>& keys) {
+        EXPECT_EQ(this->obj_.size(), keys.size());
+        for (uint64_t index = 0; index < key_count(); ++index) {
+            auto key = indexed_key(index);
+            EXPECT_EQ(this->obj_.contains(key), keys.count(key) == 1);
+        }
+        if (keys.empty()) return;
+        EXPECT_EQ(this->obj_.min(), *keys.begin());
+        EXPECT_EQ(this->obj_.max(), *keys.rbegin());
+    }
+};
+
+TYPED_TEST_SUITE_P(ConcurrencyFixture);
+
+TYPED_TEST_P(ConcurrencyFixture, ConcurrentInsert) {
+    using key_type = typename TypeParam::key_type;
+
+    // Every thread inserts its own interleaved share of the keys.
+    this->run_threads([this](int thread) {
+        for (uint64_t index = thread; index < this->key_count(); index += THREAD_COUNT)
+            this->obj_.insert(this->indexed_key(index));
+    });
+
+    std::set<key_type> keys;
+    for (uint64_t index = 0; index < this->key_count(); ++index)
+        keys.insert(this->indexed_key(index));
+    this->check_keys(keys);
+}
+
+TYPED_TEST_P(ConcurrencyFixture, ConcurrentInsertRemove) {
+    using key_type = typename TypeParam::key_type;
+
+    // Every thread randomly inserts and removes its own share of the keys, and remembers which
+    // of them are left.
+    std::vector<std::set<key_type>> thread_keys(THREAD_COUNT);
+    this->run_threads([this, &thread_keys](int thread) {
+        std::mt19937_64 mte(thread);
+        auto& keys = thread_keys[thread];
+        auto count = this->key_count() / THREAD_COUNT;
+        for (int update_count = 0; update_count < 4 * MAX_KEYS; ++update_count) {
+            auto key = this->indexed_key((mte() % count) * THREAD_COUNT + thread);
+            if (mte() % 2 == 0) {
+                this->obj_.insert(key);
+                keys.insert(key);
+            } else {
+                this->obj_.remove(key);
+                keys.erase(key);
+            }
+        }
+    });
+
+    std::set<key_type> keys;
+    for (auto& some_keys : thread_keys)
+        keys.insert(some_keys.begin(), some_keys.end());
+    this->check_keys(keys);
+}
+
+TYPED_TEST_P(ConcurrencyFixture, ConcurrentReadsDuringUpdates) {
+    // The keys with even indices stay in the object, while writers insert and remove the keys
+    // with odd indices. Readers check answers that do not depend on the writers.
+    for (uint64_t index = 0; index < this->key_count(); index += 2)
+        this->obj_.insert(this->indexed_key(index));
+
+    std::atomic<int> errors(0);
+    this->run_threads([this, &errors](int thread) {
+        std::mt19937_64 mte(thread);
+        auto count = this->key_count() / 2;
+        for (int operation_count = 0; operation_count < 4 * MAX_KEYS; ++operation_count) {
+            auto index = 2 * (mte() % count);
+            auto key = this->indexed_key(index);
+            if (thread % 2 == 0) {
+                auto odd_key = this->indexed_key(index + 1);
+                if (mte() % 2 == 0) this->obj_.insert(odd_key);
+                else this->obj_.remove(odd_key);
+            } else {
+                if (!this->obj_.contains(key)) errors += 1;
+                if (this->obj_.predecessor(key + 1) != key) errors += 1;
+                auto successor = this->obj_.successor(key);
+                if (index + 2 < this->key_count() &&
+                    (successor < this->indexed_key(index + 1) || successor > this->indexed_key(index + 2)))
+                    errors += 1;
+            }
+        }
+    });
+    EXPECT_EQ(errors.load(), 0);
+
+    for (uint64_t index = 0; index < this->key_count(); index += 2)
+        EXPECT_TRUE(this->obj_.contains(this->indexed_key(index)));
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ConcurrencyFixture,
+    ConcurrentInsert, ConcurrentInsertRemove, ConcurrentReadsDuringUpdates);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ConcurrencyFixture);
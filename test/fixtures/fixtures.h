@@ -17,40 +17,100 @@
 #include "max-fixture.h"
 #include "insert-fixture.h"
 #include "remove-fixture.h"
+#include "batch-fixture.h"
+#include "bulk-load-fixture.h"
+#include "iterator-fixture.h"
+#include "range-fixture.h"
+#include "order-statistic-fixture.h"
+#include "concurrency-fixture.h"
+#include "map-fixture.h"
+#include "multiset-fixture.h"
+#include "serialization-fixture.h"
+#include "frozen-fixture.h"
+#include "memory-fixture.h"
+#include "operation-stats-fixture.h"
 
 #define DEFINE_OBJ_TYPES(OBJ_TYPE) \
-    using ObjTypes = testing::Types<OBJ_TYPE<uint8_t>, OBJ_TYPE<uint16_t>, OBJ_TYPE<uint32_t>, OBJ_TYPE<uint64_t>>;
+    using OBJ_TYPE ## Types = testing::Types<OBJ_TYPE<uint8_t>, OBJ_TYPE<uint16_t>, OBJ_TYPE<uint32_t>, OBJ_TYPE<uint64_t>>;
 
 #define DEFINE_SIZE_TESTS(OBJ_TYPE) \
     DEFINE_OBJ_TYPES(OBJ_TYPE); \
-    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, SizeFixture, ObjTypes);
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, SizeFixture, OBJ_TYPE ## Types);
 
 #define DEFINE_CONTAINS_TESTS(OBJ_TYPE) \
     DEFINE_OBJ_TYPES(OBJ_TYPE); \
-    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, ContainsFixture, ObjTypes);
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, ContainsFixture, OBJ_TYPE ## Types);
 
 #define DEFINE_PREDECESSOR_TESTS(OBJ_TYPE) \
     DEFINE_OBJ_TYPES(OBJ_TYPE); \
-    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, PredecessorFixture, ObjTypes);
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, PredecessorFixture, OBJ_TYPE ## Types);
 
 #define DEFINE_SUCCESSOR_TESTS(OBJ_TYPE) \
     DEFINE_OBJ_TYPES(OBJ_TYPE); \
-    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, SuccessorFixture, ObjTypes);
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, SuccessorFixture, OBJ_TYPE ## Types);
 
 #define DEFINE_MIN_TESTS(OBJ_TYPE) \
     DEFINE_OBJ_TYPES(OBJ_TYPE); \
-    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, MinFixture, ObjTypes);
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, MinFixture, OBJ_TYPE ## Types);
 
 #define DEFINE_MAX_TESTS(OBJ_TYPE) \
     DEFINE_OBJ_TYPES(OBJ_TYPE); \
-    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, MaxFixture, ObjTypes);
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, MaxFixture, OBJ_TYPE ## Types);
 
 #define DEFINE_INSERT_TESTS(OBJ_TYPE) \
     DEFINE_OBJ_TYPES(OBJ_TYPE); \
-    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, InsertFixture, ObjTypes);
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, InsertFixture, OBJ_TYPE ## Types);
 
 #define DEFINE_REMOVE_TESTS(OBJ_TYPE) \
     DEFINE_OBJ_TYPES(OBJ_TYPE); \
-    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, RemoveFixture, ObjTypes);
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, RemoveFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_BATCH_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, BatchFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_BULK_LOAD_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, BulkLoadFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_ITERATOR_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, IteratorFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_RANGE_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, RangeFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_ORDER_STATISTIC_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, OrderStatisticFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_CONCURRENCY_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, ConcurrencyFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_MAP_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, MapFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_MULTISET_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, MultisetFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_SERIALIZATION_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, SerializationFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_FROZEN_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, FrozenFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_MEMORY_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, MemoryFixture, OBJ_TYPE ## Types);
+
+#define DEFINE_OPERATION_STATS_TESTS(OBJ_TYPE) \
+    DEFINE_OBJ_TYPES(OBJ_TYPE); \
+    INSTANTIATE_TYPED_TEST_SUITE_P(OBJ_TYPE, OperationStatsFixture, OBJ_TYPE ## Types);
 
 #define TEST_MAIN()
\ No newline at end of file
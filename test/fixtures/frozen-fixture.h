@@ -0,0 +1,182 @@
+/**
+ * @file frozen-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for read-only tries built from an image.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/constants.h"
+#include "../../src/y-fast-trie/y-fast-trie.h"
+#include "../../src/frozen-y-fast-trie/mapped-file.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <random>
+#include <fstream>
+#include <string>
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+
+/**
+ * @brief Test fixture for read-only tries, checked against a YFastTrie of the same keys.
+ * 
+ * @tparam Obj_ to test.
+ */
+template <typename Obj_>
+class FrozenFixture : public testing::Test {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    YFastTrie<key_type> trie_;
+    typename Obj_::image_type image_;
+    Obj_ obj_;
+
+    /**
+     * @brief Fill the reference trie with random keys and attach to their image.
+     * 
+     * @param count is the number of keys to insert.
+     */
+    void fill(int count) {
+        std::mt19937_64 mte;
+        std::uniform_int_distribution<uint64_t> dist(Obj_::lower_bound(), Obj_::upper_bound());
+        for (int insert_count = 0; insert_count < count; ++insert_count)
+            trie_.insert(static_cast<key_type>(dist(mte)));
+        image_ = Obj_::build(trie_);
+        ASSERT_TRUE(obj_.attach(image_.data(), image_.size()));
+    }
+
+    /**
+     * @brief Check every query of a trie around a key against the reference trie.
+     * 
+     * @param obj to check.
+     * @param key to query.
+     */
+    void check_queries(const Obj_& obj, key_type key) {
+        EXPECT_EQ(obj.contains(key), trie_.contains(key));
+        EXPECT_EQ(obj.predecessor(key), trie_.predecessor(key));
+        EXPECT_EQ(obj.successor(key), trie_.successor(key));
+    }
+
+    /**
+     * @brief Check every query of a trie against the reference trie.
+     * 
+     * @param obj to check.
+     */
+    void check_against_trie(const Obj_& obj) {
+        EXPECT_EQ(obj.size(), trie_.size());
+        EXPECT_EQ(obj.empty(), trie_.empty());
+        EXPECT_EQ(obj.min(), trie_.min());
+        EXPECT_EQ(obj.max(), trie_.max());
+        check_queries(obj, Obj_::lower_bound());
+        check_queries(obj, Obj_::upper_bound());
+        for (auto key : trie_) {
+            check_queries(obj, static_cast<key_type>(key - 1));
+            check_queries(obj, key);
+            check_queries(obj, static_cast<key_type>(key + 1));
+        }
+    }
+};
+
+TYPED_TEST_SUITE_P(FrozenFixture);
+
+TYPED_TEST_P(FrozenFixture, FrozenNotAttached) {
+    EXPECT_TRUE(this->obj_.empty());
+    EXPECT_TRUE(this->obj_.verify());
+    this->check_against_trie(this->obj_);
+}
+
+TYPED_TEST_P(FrozenFixture, FrozenNoKeys) {
+    this->fill(0);
+    EXPECT_TRUE(this->obj_.verify());
+    this->check_against_trie(this->obj_);
+}
+
+TYPED_TEST_P(FrozenFixture, FrozenEverySize) {
+    using key_type = typename TypeParam::key_type;
+
+    // Cover every way the keys can be cut into buckets, including keys at both bounds.
+    for (size_t size = 1; size <= 4 * TypeParam::bucket_size(); ++size) {
+        std::vector<key_type> keys;
+        for (size_t i = 0; i < size; ++i)
+            keys.push_back(static_cast<key_type>(TypeParam::upper_bound() - 2 * (size - i - 1)));
+        keys.front() = TypeParam::lower_bound();
+
+        auto image = TypeParam::build(keys.begin(), keys.end());
+        TypeParam obj;
+        ASSERT_TRUE(obj.attach(image.data(), image.size()));
+        ASSERT_EQ(obj.size(), size);
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_TRUE(obj.contains(keys[i]));
+            ASSERT_EQ(obj.successor(keys[i]), i + 1 < size ? std::optional<key_type>(keys[i + 1]) : std::nullopt);
+            ASSERT_EQ(obj.predecessor(keys[i]), i > 0 ? std::optional<key_type>(keys[i - 1]) : std::nullopt);
+        }
+    }
+}
+
+TYPED_TEST_P(FrozenFixture, FrozenSomeKeys) {
+    this->fill(MAX_KEYS);
+    EXPECT_TRUE(this->obj_.verify());
+    this->check_against_trie(this->obj_);
+}
+
+TYPED_TEST_P(FrozenFixture, FrozenMappedFile) {
+    this->fill(MAX_KEYS);
+
+    // The image holds no pointers, so it can be queried at any address.
+    char path[] = "/tmp/frozen-fixture-XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    std::ofstream(path, std::ios::binary).write(this->image_.data(), this->image_.size());
+
+    MappedFile file;
+    ASSERT_TRUE(file.open(path));
+    std::remove(path);
+    TypeParam obj;
+    ASSERT_TRUE(obj.attach(file.data(), file.size()));
+    EXPECT_TRUE(obj.verify());
+    this->check_against_trie(obj);
+}
+
+TYPED_TEST_P(FrozenFixture, FrozenRejectsBadImages) {
+    this->fill(MAX_KEYS);
+    auto& image = this->image_;
+    TypeParam obj;
+
+    // The size must match the header.
+    EXPECT_FALSE(obj.attach(image.data(), image.size() - 1));
+    EXPECT_FALSE(obj.attach(image.data(), 8));
+    EXPECT_TRUE(obj.empty());
+
+    // A damaged header is rejected when attaching.
+    auto corrupted = image;
+    corrupted[0] ^= 1;
+    EXPECT_FALSE(obj.attach(corrupted.data(), corrupted.size()));
+
+    // A damaged body is only found by verify.
+    corrupted = image;
+    corrupted[corrupted.size() / 2] ^= 1;
+    ASSERT_TRUE(obj.attach(corrupted.data(), corrupted.size()));
+    EXPECT_FALSE(obj.verify());
+
+    // So is a damaged size that is consistent with the bucket count, which would otherwise drop
+    // the last keys.
+    corrupted = image;
+    uint64_t size, bucket_count;
+    std::memcpy(&size, corrupted.data() + 16, sizeof(size));
+    ASSERT_GT(size, 1u);
+    size -= 1;
+    bucket_count = (size + TypeParam::bucket_size() - 1) / TypeParam::bucket_size();
+    std::memcpy(corrupted.data() + 16, &size, sizeof(size));
+    std::memcpy(corrupted.data() + 24, &bucket_count, sizeof(bucket_count));
+    ASSERT_TRUE(obj.attach(corrupted.data(), corrupted.size()));
+    EXPECT_FALSE(obj.verify());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(FrozenFixture,
+    FrozenNotAttached, FrozenNoKeys, FrozenEverySize, FrozenSomeKeys, FrozenMappedFile,
+    FrozenRejectsBadImages);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(FrozenFixture);
@@ -0,0 +1,121 @@
+/**
+ * @file iterator-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for the iterators.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include <set>
+#include <vector>
+#include <random>
+#include <iterator>
+
+template <typename Obj_>
+class IteratorFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    std::set<key_type> keys_;
+
+    /**
+     * @brief Insert random keys into the object and the reference set.
+     * 
+     * @param count is the number of keys to insert.
+     */
+    void insert_random_keys(int count) {
+        std::mt19937_64 mte;
+        std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+        for (int insert_count = 0; insert_count < count; ++insert_count) {
+            auto key = static_cast<key_type>(dist(mte));
+            this->obj_.insert(key);
+            keys_.insert(key);
+        }
+    }
+
+    /**
+     * @brief Check that iterating forwards and backwards visits the reference keys in order.
+     * 
+     */
+    void check_iteration() {
+        std::vector<key_type> forward(this->obj_.begin(), this->obj_.end());
+        EXPECT_EQ(forward, std::vector<key_type>(keys_.begin(), keys_.end()));
+
+        std::vector<key_type> backward;
+        for (auto it = this->obj_.end(); it != this->obj_.begin();)
+            backward.push_back(*--it);
+        EXPECT_EQ(backward, std::vector<key_type>(keys_.rbegin(), keys_.rend()));
+    }
+
+    /**
+     * @brief Check lower_bound and upper_bound against the reference keys.
+     * 
+     * @param key to search for.
+     */
+    void check_bounds(key_type key) {
+        auto lower = this->obj_.lower_bound(key);
+        auto expected_lower = keys_.lower_bound(key);
+        if (expected_lower == keys_.end()) EXPECT_TRUE(lower == this->obj_.end());
+        else EXPECT_EQ(*lower, *expected_lower);
+
+        auto upper = this->obj_.upper_bound(key);
+        auto expected_upper = keys_.upper_bound(key);
+        if (expected_upper == keys_.end()) EXPECT_TRUE(upper == this->obj_.end());
+        else EXPECT_EQ(*upper, *expected_upper);
+    }
+};
+
+TYPED_TEST_SUITE_P(IteratorFixture);
+
+TYPED_TEST_P(IteratorFixture, IteratorEmpty) {
+    EXPECT_TRUE(this->obj_.begin() == this->obj_.end());
+    EXPECT_TRUE(this->obj_.lower_bound(this->obj_.lower_bound()) == this->obj_.end());
+    EXPECT_TRUE(this->obj_.upper_bound(this->obj_.lower_bound()) == this->obj_.end());
+}
+
+TYPED_TEST_P(IteratorFixture, IteratorSomeKeys) {
+    this->insert_random_keys(MAX_KEYS);
+    this->check_iteration();
+}
+
+TYPED_TEST_P(IteratorFixture, IteratorBounds) {
+    this->insert_random_keys(MAX_KEYS);
+    this->obj_.insert(this->obj_.upper_bound());
+    this->keys_.insert(this->obj_.upper_bound());
+
+    this->check_bounds(this->obj_.lower_bound());
+    this->check_bounds(this->obj_.upper_bound());
+    for (auto key : this->keys_) {
+        this->check_bounds(key - 1);
+        this->check_bounds(key);
+        this->check_bounds(key + 1);
+    }
+}
+
+TYPED_TEST_P(IteratorFixture, IteratorAfterRemoves) {
+    this->insert_random_keys(MAX_KEYS);
+
+    // Remove every other key, which merges partitions.
+    bool remove = true;
+    for (auto it = this->keys_.begin(); it != this->keys_.end();) {
+        if (remove) {
+            this->obj_.remove(*it);
+            it = this->keys_.erase(it);
+        } else {
+            ++it;
+        }
+        remove = !remove;
+    }
+
+    this->check_iteration();
+    for (auto key : this->keys_)
+        this->check_bounds(key + 1);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(IteratorFixture,
+    IteratorEmpty, IteratorSomeKeys, IteratorBounds, IteratorAfterRemoves);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(IteratorFixture);
@@ -0,0 +1,147 @@
+/**
+ * @file map-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for ordered maps.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include <map>
+#include <memory>
+#include <random>
+
+/**
+ * @brief Test fixture for ordered maps from keys to std::unique_ptr<uint64_t>, so that any copy
+ * of a value fails to compile.
+ * 
+ * @tparam Obj_ to test.
+ */
+template <typename Obj_>
+class MapFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    std::map<key_type, uint64_t> entries_;
+
+    /**
+     * @brief Check a found value against the reference entries.
+     * 
+     * @param key that was searched for.
+     * @param value that was found, which may be nullptr.
+     */
+    void check_value(key_type key, const std::unique_ptr<uint64_t>* value) {
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            EXPECT_EQ(value, nullptr);
+        } else {
+            ASSERT_NE(value, nullptr);
+            EXPECT_EQ(**value, it->second);
+        }
+    }
+
+    /**
+     * @brief Check every query of a key against the reference entries.
+     * 
+     * @param key to query.
+     */
+    void check_queries(key_type key) {
+        EXPECT_EQ(this->obj_.contains(key), entries_.count(key) == 1);
+        check_value(key, this->obj_.find(key));
+        check_value(key, static_cast<const Obj_&>(this->obj_).find(key));
+
+        auto predecessor = this->obj_.predecessor_entry(key);
+        auto it = entries_.lower_bound(key);
+        if (it == entries_.begin()) {
+            EXPECT_FALSE(predecessor.has_value());
+        } else {
+            ASSERT_TRUE(predecessor.has_value());
+            EXPECT_EQ(predecessor->first, std::prev(it)->first);
+            EXPECT_EQ(**predecessor->second, std::prev(it)->second);
+        }
+
+        auto successor = this->obj_.successor_entry(key);
+        it = entries_.upper_bound(key);
+        if (it == entries_.end()) {
+            EXPECT_FALSE(successor.has_value());
+        } else {
+            ASSERT_TRUE(successor.has_value());
+            EXPECT_EQ(successor->first, it->first);
+            EXPECT_EQ(**successor->second, it->second);
+        }
+    }
+};
+
+TYPED_TEST_SUITE_P(MapFixture);
+
+TYPED_TEST_P(MapFixture, MapEmpty) {
+    EXPECT_EQ(this->obj_.size(), 0);
+    EXPECT_FALSE(this->obj_.erase(this->obj_.lower_bound()));
+    this->check_queries(this->obj_.lower_bound());
+    this->check_queries(this->obj_.upper_bound());
+}
+
+TYPED_TEST_P(MapFixture, MapInsertOrAssign) {
+    using key_type = typename TypeParam::key_type;
+
+    std::mt19937_64 mte;
+    std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+    for (int insert_count = 0; insert_count < MAX_KEYS; ++insert_count) {
+        auto key = static_cast<key_type>(dist(mte));
+        auto value = mte();
+        bool inserted = this->obj_.insert_or_assign(key, std::make_unique<uint64_t>(value));
+        EXPECT_EQ(inserted, this->entries_.count(key) == 0);
+        this->entries_[key] = value;
+        EXPECT_EQ(this->obj_.size(), this->entries_.size());
+    }
+
+    for (auto& entry : this->entries_)
+        this->check_queries(entry.first);
+}
+
+TYPED_TEST_P(MapFixture, MapTryEmplace) {
+    auto key = this->obj_.upper_bound();
+    EXPECT_TRUE(this->obj_.try_emplace(key, new uint64_t(1)));
+    std::unique_ptr<uint64_t> value(new uint64_t(2));
+    EXPECT_FALSE(this->obj_.try_emplace(key, std::move(value)));
+
+    // A value that is not inserted is not moved from either.
+    EXPECT_NE(value, nullptr);
+    this->entries_[key] = 1;
+    this->check_queries(key);
+}
+
+TYPED_TEST_P(MapFixture, MapRandomOperations) {
+    using key_type = typename TypeParam::key_type;
+
+    std::mt19937_64 mte;
+    std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+
+    // Erasing as often as inserting splits and merges the buckets many times, which moves the
+    // values around.
+    for (int update_count = 0; update_count < 8 * MAX_KEYS; ++update_count) {
+        auto key = static_cast<key_type>(dist(mte));
+        if (mte() % 2 == 0) {
+            auto value = mte();
+            this->obj_.insert_or_assign(key, std::make_unique<uint64_t>(value));
+            this->entries_[key] = value;
+        } else {
+            auto it = this->entries_.lower_bound(key);
+            if (it == this->entries_.end()) continue;
+            EXPECT_TRUE(this->obj_.erase(it->first));
+            this->entries_.erase(it);
+        }
+        EXPECT_EQ(this->obj_.size(), this->entries_.size());
+        this->check_queries(static_cast<key_type>(dist(mte)));
+    }
+
+    for (auto& entry : this->entries_)
+        this->check_queries(entry.first);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(MapFixture,
+    MapEmpty, MapInsertOrAssign, MapTryEmplace, MapRandomOperations);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(MapFixture);
@@ -0,0 +1,101 @@
+/**
+ * @file memory-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for memory accounting.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include <vector>
+#include <random>
+
+template <typename Obj_>
+class MemoryFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    /**
+     * @brief Check that the breakdown adds up to the memory usage and that every key is counted.
+     * 
+     * @param obj to check.
+     */
+    void check_breakdown(const Obj_& obj) {
+        auto breakdown = obj.memory_breakdown();
+        EXPECT_EQ(breakdown.total(), obj.memory_usage());
+        EXPECT_EQ(breakdown.total(), breakdown.nodes + breakdown.tables + breakdown.partitions + breakdown.slack);
+        EXPECT_GE(breakdown.nodes + breakdown.partitions, obj.size() * sizeof(key_type));
+    }
+
+    /**
+     * @brief Generate distinct random keys.
+     * 
+     * @param count of keys to generate, at most.
+     * @return the keys.
+     */
+    std::vector<key_type> random_keys(int count) {
+        std::mt19937_64 mte;
+        std::uniform_int_distribution<key_type> dist(Obj_::lower_bound(), Obj_::upper_bound());
+        std::vector<key_type> keys;
+        Obj_ seen;
+        for (int i = 0; i < count; ++i) {
+            auto key = dist(mte);
+            if (seen.contains(key)) continue;
+            seen.insert(key);
+            keys.push_back(key);
+        }
+        return keys;
+    }
+};
+
+TYPED_TEST_SUITE_P(MemoryFixture);
+
+TYPED_TEST_P(MemoryFixture, MemoryWhileEmpty) {
+    auto breakdown = this->obj_.memory_breakdown();
+    EXPECT_EQ(breakdown.nodes, 0);
+    EXPECT_EQ(breakdown.partitions, 0);
+    EXPECT_EQ(breakdown.total(), this->obj_.memory_usage());
+}
+
+TYPED_TEST_P(MemoryFixture, MemoryIncreasing) {
+    auto keys = this->random_keys(MAX_KEYS);
+    auto last_breakdown = this->obj_.memory_breakdown();
+    for (auto key : keys) {
+        this->obj_.insert(key);
+        this->check_breakdown(this->obj_);
+        auto breakdown = this->obj_.memory_breakdown();
+        EXPECT_GE(breakdown.nodes + breakdown.partitions, last_breakdown.nodes + last_breakdown.partitions);
+        last_breakdown = breakdown;
+    }
+    EXPECT_GT(this->obj_.memory_usage(), 0);
+}
+
+TYPED_TEST_P(MemoryFixture, MemoryInsertTwice) {
+    auto keys = this->random_keys(MAX_KEYS);
+    for (auto key : keys)
+        this->obj_.insert(key);
+    auto memory = this->obj_.memory_usage();
+    for (auto key : keys)
+        this->obj_.insert(key);
+    EXPECT_EQ(this->obj_.memory_usage(), memory);
+}
+
+TYPED_TEST_P(MemoryFixture, MemoryReleasedByRemove) {
+    auto keys = this->random_keys(MAX_KEYS);
+    for (auto key : keys)
+        this->obj_.insert(key);
+    for (auto key : keys) {
+        this->obj_.remove(key);
+        this->check_breakdown(this->obj_);
+    }
+    auto breakdown = this->obj_.memory_breakdown();
+    EXPECT_EQ(breakdown.nodes, 0);
+    EXPECT_EQ(breakdown.partitions, 0);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(MemoryFixture,
+    MemoryWhileEmpty, MemoryIncreasing, MemoryInsertTwice, MemoryReleasedByRemove);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(MemoryFixture);
@@ -0,0 +1,132 @@
+/**
+ * @file multiset-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for ordered multisets.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include <map>
+#include <random>
+
+/**
+ * @brief Test fixture for ordered multisets, checked against a reference map from each key to its
+ * number of copies.
+ * 
+ * @tparam Obj_ to test.
+ */
+template <typename Obj_>
+class MultisetFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    std::map<key_type, size_t> counts_;
+    size_t size_ = 0;
+
+    /**
+     * @brief Check the sizes and every query of a key against the reference counts.
+     * 
+     * @param key to query.
+     */
+    void check_queries(key_type key) {
+        EXPECT_EQ(this->obj_.size(), size_);
+        EXPECT_EQ(this->obj_.distinct_size(), counts_.size());
+        EXPECT_EQ(this->obj_.empty(), size_ == 0);
+
+        auto it = counts_.find(key);
+        EXPECT_EQ(this->obj_.count(key), it == counts_.end() ? 0 : it->second);
+        EXPECT_EQ(this->obj_.contains(key), it != counts_.end());
+
+        // Duplicates are skipped by predecessor and successor.
+        auto predecessor = this->obj_.predecessor(key);
+        it = counts_.lower_bound(key);
+        if (it == counts_.begin()) EXPECT_FALSE(predecessor.has_value());
+        else EXPECT_EQ(predecessor, std::prev(it)->first);
+
+        auto successor = this->obj_.successor(key);
+        it = counts_.upper_bound(key);
+        if (it == counts_.end()) EXPECT_FALSE(successor.has_value());
+        else EXPECT_EQ(successor, it->first);
+
+        if (counts_.empty()) {
+            EXPECT_FALSE(this->obj_.min().has_value());
+            EXPECT_FALSE(this->obj_.max().has_value());
+        } else {
+            EXPECT_EQ(this->obj_.min(), counts_.begin()->first);
+            EXPECT_EQ(this->obj_.max(), counts_.rbegin()->first);
+        }
+    }
+};
+
+TYPED_TEST_SUITE_P(MultisetFixture);
+
+TYPED_TEST_P(MultisetFixture, MultisetEmpty) {
+    this->obj_.remove(this->obj_.lower_bound());
+    EXPECT_EQ(this->obj_.erase(this->obj_.upper_bound()), 0);
+    this->check_queries(this->obj_.lower_bound());
+    this->check_queries(this->obj_.upper_bound());
+}
+
+TYPED_TEST_P(MultisetFixture, MultisetInsertDuplicates) {
+    auto key = this->obj_.upper_bound();
+    for (size_t copies = 1; copies <= 3; ++copies) {
+        this->obj_.insert(key);
+        this->counts_[key] += 1;
+        this->size_ += 1;
+        this->check_queries(key);
+    }
+
+    this->obj_.remove(key);
+    this->counts_[key] -= 1;
+    this->size_ -= 1;
+    this->check_queries(key);
+
+    EXPECT_EQ(this->obj_.erase(key), 2);
+    this->counts_.erase(key);
+    this->size_ -= 2;
+    this->check_queries(key);
+}
+
+TYPED_TEST_P(MultisetFixture, MultisetRandomOperations) {
+    using key_type = typename TypeParam::key_type;
+
+    std::mt19937_64 mte;
+
+    // Few distinct keys give many duplicates, while the removes still empty keys often enough to
+    // split and merge the buckets.
+    auto upper_bound = std::min<uint64_t>(this->obj_.upper_bound(), 4 * MAX_KEYS);
+    std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), upper_bound);
+    for (int update_count = 0; update_count < 8 * MAX_KEYS; ++update_count) {
+        auto key = static_cast<key_type>(dist(mte));
+        auto operation = mte() % 8;
+        if (operation < 4) {
+            this->obj_.insert(key);
+            this->counts_[key] += 1;
+            this->size_ += 1;
+        } else if (operation < 7) {
+            auto it = this->counts_.lower_bound(key);
+            if (it == this->counts_.end()) continue;
+            this->obj_.remove(it->first);
+            this->size_ -= 1;
+            if (--it->second == 0) this->counts_.erase(it);
+        } else {
+            auto it = this->counts_.find(key);
+            auto count = it == this->counts_.end() ? 0 : it->second;
+            EXPECT_EQ(this->obj_.erase(key), count);
+            if (count != 0) this->counts_.erase(it);
+            this->size_ -= count;
+        }
+        this->check_queries(static_cast<key_type>(dist(mte)));
+    }
+
+    for (auto& count : this->counts_)
+        this->check_queries(count.first);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(MultisetFixture,
+    MultisetEmpty, MultisetInsertDuplicates, MultisetRandomOperations);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(MultisetFixture);
@@ -0,0 +1,104 @@
+/**
+ * @file operation-stats-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for operation counters.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include <vector>
+#include <random>
+
+template <typename Obj_>
+class OperationStatsFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    /**
+     * @brief Insert distinct random keys.
+     * 
+     * @param count of keys to insert, at most.
+     * @return the inserted keys.
+     */
+    std::vector<key_type> insert_random_keys(int count) {
+        std::mt19937_64 mte;
+        std::uniform_int_distribution<key_type> dist(Obj_::lower_bound(), Obj_::upper_bound());
+        std::vector<key_type> keys;
+        for (int i = 0; i < count; ++i) {
+            auto key = dist(mte);
+            if (this->obj_.contains(key)) continue;
+            this->obj_.insert(key);
+            keys.push_back(key);
+        }
+        return keys;
+    }
+
+    /**
+     * @brief Check that every counter is 0.
+     * 
+     * @param counters to check.
+     */
+    void expect_zero(const OperationCounters& counters) {
+        EXPECT_EQ(counters.hash_probes, 0);
+        EXPECT_EQ(counters.search_steps, 0);
+        EXPECT_EQ(counters.splits, 0);
+        EXPECT_EQ(counters.merges, 0);
+        EXPECT_EQ(counters.nodes_allocated, 0);
+        EXPECT_EQ(counters.nodes_freed, 0);
+        EXPECT_EQ(counters.rotations, 0);
+    }
+};
+
+TYPED_TEST_SUITE_P(OperationStatsFixture);
+
+TYPED_TEST_P(OperationStatsFixture, OperationStatsWhileEmpty) {
+    this->expect_zero(this->obj_.operation_counters());
+}
+
+TYPED_TEST_P(OperationStatsFixture, OperationStatsCountAllocations) {
+    auto keys = this->insert_random_keys(MAX_KEYS);
+    auto counters = this->obj_.operation_counters();
+    EXPECT_GT(counters.nodes_allocated, counters.nodes_freed);
+
+    for (auto key : keys)
+        this->obj_.remove(key);
+    counters = this->obj_.operation_counters();
+    EXPECT_EQ(counters.nodes_allocated, counters.nodes_freed);
+}
+
+TYPED_TEST_P(OperationStatsFixture, OperationStatsQueriesDoNotAllocate) {
+    auto keys = this->insert_random_keys(MAX_KEYS);
+    auto before = this->obj_.operation_counters();
+    for (auto key : keys) {
+        this->obj_.predecessor(key);
+        this->obj_.successor(key);
+    }
+    auto after = this->obj_.operation_counters();
+    EXPECT_EQ(after.nodes_allocated, before.nodes_allocated);
+    EXPECT_EQ(after.nodes_freed, before.nodes_freed);
+    EXPECT_EQ(after.splits, before.splits);
+    EXPECT_EQ(after.merges, before.merges);
+    EXPECT_EQ(after.rotations, before.rotations);
+    EXPECT_GE(after.hash_probes, before.hash_probes);
+    EXPECT_GE(after.search_steps, before.search_steps);
+}
+
+TYPED_TEST_P(OperationStatsFixture, OperationStatsReset) {
+    auto keys = this->insert_random_keys(MAX_KEYS);
+    this->obj_.reset_operation_counters();
+    this->expect_zero(this->obj_.operation_counters());
+
+    for (auto key : keys)
+        this->obj_.remove(key);
+    auto counters = this->obj_.operation_counters();
+    EXPECT_GT(counters.nodes_freed, counters.nodes_allocated);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(OperationStatsFixture,
+    OperationStatsWhileEmpty, OperationStatsCountAllocations, OperationStatsQueriesDoNotAllocate,
+    OperationStatsReset);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(OperationStatsFixture);
@@ -0,0 +1,93 @@
+/**
+ * @file order-statistic-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for rank and select.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include <set>
+#include <vector>
+#include <random>
+#include <iterator>
+
+template <typename Obj_>
+class OrderStatisticFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    std::set<key_type> keys_;
+
+    /**
+     * @brief Check rank and select against the reference keys.
+     * 
+     * @param key to rank.
+     * @param index to select.
+     */
+    void check_order_statistics(key_type key, size_t index) {
+        size_t expected_rank = std::distance(keys_.begin(), keys_.lower_bound(key));
+        EXPECT_EQ(this->obj_.rank(key), expected_rank);
+
+        if (index < keys_.size()) EXPECT_EQ(this->obj_.select(index), *std::next(keys_.begin(), index));
+        else EXPECT_FALSE(this->obj_.select(index).has_value());
+    }
+};
+
+TYPED_TEST_SUITE_P(OrderStatisticFixture);
+
+TYPED_TEST_P(OrderStatisticFixture, OrderStatisticEmpty) {
+    this->check_order_statistics(this->obj_.lower_bound(), 0);
+    this->check_order_statistics(this->obj_.upper_bound(), 1);
+}
+
+TYPED_TEST_P(OrderStatisticFixture, OrderStatisticSomeKeys) {
+    using key_type = typename TypeParam::key_type;
+
+    std::mt19937_64 mte;
+    std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+    for (int insert_count = 0; insert_count < MAX_KEYS; ++insert_count) {
+        auto key = static_cast<key_type>(dist(mte));
+        this->obj_.insert(key);
+        this->keys_.insert(key);
+    }
+
+    size_t index = 0;
+    for (auto key : this->keys_) {
+        EXPECT_EQ(this->obj_.select(index), key);
+        EXPECT_EQ(this->obj_.rank(key), index);
+        this->check_order_statistics(key + 1, index + 1);
+        index += 1;
+    }
+    this->check_order_statistics(this->obj_.upper_bound(), this->keys_.size());
+}
+
+TYPED_TEST_P(OrderStatisticFixture, OrderStatisticInterleaved) {
+    using key_type = typename TypeParam::key_type;
+
+    std::mt19937_64 mte;
+    std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+
+    // Queries between updates check the order statistics after every insert and remove, including
+    // those that split and merge partitions.
+    for (int update_count = 0; update_count < 4 * MAX_KEYS; ++update_count) {
+        auto key = static_cast<key_type>(dist(mte));
+        if (mte() % 3 != 0 && this->keys_.size() < MAX_KEYS) {
+            this->obj_.insert(key);
+            this->keys_.insert(key);
+        } else if (!this->keys_.empty()) {
+            auto it = this->keys_.lower_bound(key);
+            if (it == this->keys_.end()) it = this->keys_.begin();
+            this->obj_.remove(*it);
+            this->keys_.erase(it);
+        }
+        this->check_order_statistics(static_cast<key_type>(dist(mte)), mte() % (this->keys_.size() + 1));
+    }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(OrderStatisticFixture,
+    OrderStatisticEmpty, OrderStatisticSomeKeys, OrderStatisticInterleaved);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(OrderStatisticFixture);
@@ -12,6 +12,7 @@
 #include "base/constants.h"
 #include <vector>
 #include <algorithm>
+#include <random>
 
 template <typename Obj_>
 class PredecessorFixture : public EmptyBaseFixture<Obj_> {
@@ -69,6 +70,38 @@ TYPED_TEST_P(PredecessorFixture, PredecessorSomeUnique) {
     }
 }
 
+TYPED_TEST_P(PredecessorFixture, PredecessorUpperBoundAfterRemoves) {
+    using key_type = typename TypeParam::key_type;
+
+    auto lower_bound = this->obj_.lower_bound();
+    auto upper_bound = this->obj_.upper_bound();
+
+    std::vector<key_type> keys;
+    for (key_type key = lower_bound; (key < upper_bound) && (keys.size() < MAX_KEYS); ++key) {
+        this->obj_.insert(key);
+        keys.push_back(key);
+    }
+
+    std::mt19937_64 mte;
+    std::shuffle(keys.begin(), keys.end(), mte);
+
+    std::vector<key_type> remaining(keys);
+    std::sort(remaining.begin(), remaining.end());
+
+    for (auto key : keys) {
+        this->obj_.remove(key);
+        remaining.erase(std::lower_bound(remaining.begin(), remaining.end(), key));
+
+        if (remaining.empty())
+            EXPECT_FALSE(this->obj_.predecessor(upper_bound).has_value());
+        else {
+            ASSERT_TRUE(this->obj_.predecessor(upper_bound).has_value());
+            EXPECT_EQ(this->obj_.predecessor(upper_bound).value(), remaining.back());
+        }
+    }
+}
+
 REGISTER_TYPED_TEST_SUITE_P(PredecessorFixture,
-    PredecessorEmpty, PredecessorLowerBound, PredecessorUpperBound, PredecessorSomeUnique);
+    PredecessorEmpty, PredecessorLowerBound, PredecessorUpperBound, PredecessorSomeUnique,
+    PredecessorUpperBoundAfterRemoves);
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PredecessorFixture);
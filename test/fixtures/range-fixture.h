@@ -0,0 +1,124 @@
+/**
+ * @file range-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for the range queries.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include <set>
+#include <vector>
+#include <random>
+#include <iterator>
+
+template <typename Obj_>
+class RangeFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    std::set<key_type> keys_;
+
+    /**
+     * @brief Insert random keys into the object and the reference set.
+     * 
+     * @param count is the number of keys to insert.
+     */
+    void insert_random_keys(int count) {
+        std::mt19937_64 mte;
+        std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+        for (int insert_count = 0; insert_count < count; ++insert_count) {
+            auto key = static_cast<key_type>(dist(mte));
+            this->obj_.insert(key);
+            keys_.insert(key);
+        }
+    }
+
+    /**
+     * @brief Check every range query against the reference keys.
+     * 
+     * @param low is the smallest key of the range.
+     * @param high is the largest key of the range.
+     */
+    void check_range(key_type low, key_type high) {
+        std::vector<key_type> expected;
+        if (low <= high)
+            expected.assign(keys_.lower_bound(low), keys_.upper_bound(high));
+
+        std::vector<key_type> copied;
+        this->obj_.range(low, high, std::back_inserter(copied));
+        EXPECT_EQ(copied, expected);
+
+        std::vector<key_type> visited;
+        this->obj_.for_each_in_range(low, high, [&visited](key_type key) { visited.push_back(key); });
+        EXPECT_EQ(visited, expected);
+
+        EXPECT_EQ(this->obj_.count_range(low, high), expected.size());
+    }
+};
+
+TYPED_TEST_SUITE_P(RangeFixture);
+
+TYPED_TEST_P(RangeFixture, RangeEmpty) {
+    this->check_range(this->obj_.lower_bound(), this->obj_.upper_bound());
+    this->check_range(this->obj_.upper_bound(), this->obj_.lower_bound());
+}
+
+TYPED_TEST_P(RangeFixture, RangeWholeUniverse) {
+    this->insert_random_keys(MAX_KEYS);
+    this->check_range(this->obj_.lower_bound(), this->obj_.upper_bound());
+
+    this->obj_.insert(this->obj_.lower_bound());
+    this->keys_.insert(this->obj_.lower_bound());
+    this->obj_.insert(this->obj_.upper_bound());
+    this->keys_.insert(this->obj_.upper_bound());
+    this->check_range(this->obj_.lower_bound(), this->obj_.upper_bound());
+    this->check_range(this->obj_.lower_bound(), this->obj_.lower_bound());
+    this->check_range(this->obj_.upper_bound(), this->obj_.upper_bound());
+}
+
+TYPED_TEST_P(RangeFixture, RangeSomeKeys) {
+    using key_type = typename TypeParam::key_type;
+
+    this->insert_random_keys(MAX_KEYS);
+
+    std::mt19937_64 mte(1);
+    std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+    for (int query_count = 0; query_count < MAX_KEYS; ++query_count) {
+        auto low = static_cast<key_type>(dist(mte));
+        auto high = static_cast<key_type>(dist(mte));
+        this->check_range(low, high);
+    }
+
+    // Ranges that start and end exactly on stored keys.
+    for (auto it = this->keys_.begin(); it != this->keys_.end(); ++it) {
+        auto next = std::next(it, std::min<size_t>(50, std::distance(it, this->keys_.end()) - 1));
+        this->check_range(*it, *next);
+    }
+}
+
+TYPED_TEST_P(RangeFixture, RangeAfterRemoves) {
+    this->insert_random_keys(MAX_KEYS);
+
+    // Remove every other key, which merges partitions and leaves stale representatives.
+    bool remove = true;
+    for (auto it = this->keys_.begin(); it != this->keys_.end();) {
+        if (remove) {
+            this->obj_.remove(*it);
+            it = this->keys_.erase(it);
+        } else {
+            ++it;
+        }
+        remove = !remove;
+    }
+
+    for (auto it = this->keys_.begin(); it != this->keys_.end(); ++it)
+        this->check_range(*it + 1, *std::prev(this->keys_.end()) - 1);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(RangeFixture,
+    RangeEmpty, RangeWholeUniverse, RangeSomeKeys, RangeAfterRemoves);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(RangeFixture);
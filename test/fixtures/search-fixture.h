@@ -0,0 +1,104 @@
+/**
+ * @file search-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for the SortedArrayBucket search policies and kernels.
+ * @version 1.0
+ * @date 2026-10-16
+ * 
+ */
+
+#pragma once
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+#include "../../src/sorted-array-bucket/sorted-array-bucket-search.h"
+
+using SearchKeyTypes = testing::Types<uint8_t, uint16_t, uint32_t, uint64_t>;
+
+template <typename Key_>
+class SearchFixture : public testing::Test {
+protected:
+    using key_type = Key_;
+    using count_less_fn = sorted_array_bucket_kernels::count_less_fn<key_type>;
+
+    std::mt19937_64 gen_{42};
+
+    // Sorted arrays with sizes that cover every vector width and tail length.
+    std::vector<std::vector<key_type>> arrays() {
+        std::uniform_int_distribution<uint64_t> dist;
+        std::vector<std::vector<key_type>> arrays;
+        for (size_t size = 0; size <= 300; ++size) {
+            std::vector<key_type> keys(size);
+            for (auto& key : keys) key = static_cast<key_type>(dist(gen_));
+            std::sort(keys.begin(), keys.end());
+            arrays.push_back(keys);
+        }
+        return arrays;
+    }
+
+    // Every key in the array, its neighbours and both extremes.
+    std::vector<key_type> probes(const std::vector<key_type>& keys) {
+        std::vector<key_type> probes{
+            std::numeric_limits<key_type>::min(),
+            std::numeric_limits<key_type>::max()
+        };
+        for (auto key : keys) {
+            probes.push_back(key);
+            probes.push_back(key - 1);
+            probes.push_back(key + 1);
+        }
+        return probes;
+    }
+
+    static size_t expected_rank(const std::vector<key_type>& keys, key_type key) {
+        return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+    }
+
+    void check_count_less(count_less_fn count_less) {
+        for (const auto& keys : arrays())
+            for (auto key : probes(keys))
+                ASSERT_EQ(count_less(keys.data(), keys.size(), key), expected_rank(keys, key));
+    }
+
+    template <typename Search_>
+    void check_rank() {
+        for (const auto& keys : arrays())
+            for (auto key : probes(keys))
+                ASSERT_EQ(Search_::rank(keys.data(), keys.size(), key), expected_rank(keys, key));
+    }
+};
+
+TYPED_TEST_SUITE(SearchFixture, SearchKeyTypes);
+
+TYPED_TEST(SearchFixture, BranchlessRank) {
+    this->template check_rank<BranchlessSearch>();
+}
+
+TYPED_TEST(SearchFixture, SimdRank) {
+    this->template check_rank<SimdSearch>();
+}
+
+TYPED_TEST(SearchFixture, ScalarCountLess) {
+    this->check_count_less(&sorted_array_bucket_kernels::scalar::count_less<TypeParam>);
+}
+
+#if SORTED_ARRAY_BUCKET_X86
+
+TYPED_TEST(SearchFixture, Sse42CountLess) {
+    if (!sorted_array_bucket_kernels::sse42::supported()) GTEST_SKIP();
+    this->check_count_less(&sorted_array_bucket_kernels::sse42::count_less);
+}
+
+TYPED_TEST(SearchFixture, Avx2CountLess) {
+    if (!sorted_array_bucket_kernels::avx2::supported()) GTEST_SKIP();
+    this->check_count_less(&sorted_array_bucket_kernels::avx2::count_less);
+}
+
+TYPED_TEST(SearchFixture, Avx512CountLess) {
+    if (!sorted_array_bucket_kernels::avx512::supported()) GTEST_SKIP();
+    this->check_count_less(&sorted_array_bucket_kernels::avx512::count_less);
+}
+
+#endif
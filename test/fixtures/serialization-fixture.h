@@ -0,0 +1,177 @@
+/**
+ * @file serialization-fixture.h
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @brief Test fixture for saving and loading.
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#pragma once
+#include "base/empty-base-fixture.h"
+#include "base/constants.h"
+#include "../../src/y-fast-trie/y-fast-trie.h"
+#include <vector>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+template <typename Obj_>
+class SerializationFixture : public EmptyBaseFixture<Obj_> {
+protected:
+    using key_type = typename Obj_::key_type;
+
+    std::vector<key_type> keys_;
+
+    /**
+     * @brief Fill the object with random keys, removing some of them again so that the buckets
+     * are not all of the same size.
+     * 
+     */
+    void fill() {
+        std::mt19937_64 mte;
+        std::uniform_int_distribution<uint64_t> dist(this->obj_.lower_bound(), this->obj_.upper_bound());
+        for (int insert_count = 0; insert_count < MAX_KEYS; ++insert_count)
+            this->obj_.insert(static_cast<key_type>(dist(mte)));
+        this->obj_.insert(this->obj_.upper_bound());
+        for (int remove_count = 0; remove_count < MAX_KEYS / 2; ++remove_count)
+            this->obj_.remove(static_cast<key_type>(dist(mte)));
+        keys_.assign(this->obj_.begin(), this->obj_.end());
+    }
+
+    /**
+     * @brief Save the object to a string.
+     * 
+     * @return std::string saved object.
+     */
+    std::string save() {
+        std::ostringstream os(std::ios::binary);
+        this->obj_.save(os);
+        EXPECT_TRUE(os.good());
+        return os.str();
+    }
+
+    /**
+     * @brief Check that a string does not load, and that the object it was loaded into stays
+     * empty and usable.
+     * 
+     * @param data to load.
+     */
+    void check_rejected(const std::string& data) {
+        Obj_ obj;
+        std::istringstream is(data, std::ios::binary);
+        EXPECT_FALSE(obj.load(is));
+        EXPECT_TRUE(obj.empty());
+        EXPECT_FALSE(obj.min().has_value());
+        obj.insert(obj.upper_bound());
+        EXPECT_TRUE(obj.contains(obj.upper_bound()));
+    }
+};
+
+TYPED_TEST_SUITE_P(SerializationFixture);
+
+TYPED_TEST_P(SerializationFixture, SaveLoadEmpty) {
+    std::istringstream is(this->save(), std::ios::binary);
+    TypeParam obj;
+    EXPECT_TRUE(obj.load(is));
+    EXPECT_TRUE(obj.empty());
+    EXPECT_FALSE(obj.max().has_value());
+}
+
+TYPED_TEST_P(SerializationFixture, SaveLoadSomeKeys) {
+    this->fill();
+    std::istringstream is(this->save(), std::ios::binary);
+    TypeParam obj;
+    ASSERT_TRUE(obj.load(is));
+
+    EXPECT_EQ(obj.size(), this->keys_.size());
+    EXPECT_EQ(std::vector<typename TestFixture::key_type>(obj.begin(), obj.end()), this->keys_);
+    for (auto key : this->keys_) {
+        EXPECT_EQ(obj.predecessor(key), this->obj_.predecessor(key));
+        EXPECT_EQ(obj.successor(key), this->obj_.successor(key));
+        EXPECT_EQ(obj.contains(key - 1), this->obj_.contains(key - 1));
+    }
+    EXPECT_EQ(obj.rank(obj.upper_bound()), this->obj_.rank(this->obj_.upper_bound()));
+
+    // Loaded buckets must split and merge like inserted ones.
+    for (auto key : this->keys_)
+        obj.remove(key);
+    EXPECT_TRUE(obj.empty());
+    for (auto key : this->keys_)
+        obj.insert(key);
+    EXPECT_EQ(obj.size(), this->keys_.size());
+}
+
+TYPED_TEST_P(SerializationFixture, UpdateAfterLoad) {
+    using key_type = typename TypeParam::key_type;
+
+    // Small tries load into balanced trees of one to a few nodes, which must take updates.
+    for (key_type count = 1; count <= 4; ++count) {
+        TypeParam saved;
+        for (key_type key = 1; key <= count; ++key)
+            saved.insert(key * 4);
+        std::ostringstream os(std::ios::binary);
+        saved.save(os);
+
+        std::istringstream is(os.str(), std::ios::binary);
+        TypeParam obj;
+        ASSERT_TRUE(obj.load(is));
+        obj.insert(count * 4 + 1);
+        obj.insert(1);
+        EXPECT_EQ(obj.size(), count + 2);
+        EXPECT_TRUE(obj.contains(count * 4 + 1));
+        EXPECT_EQ(obj.min(), key_type(1));
+        obj.remove(4);
+        obj.remove(1);
+        EXPECT_EQ(obj.size(), count);
+        EXPECT_FALSE(obj.contains(4));
+        EXPECT_EQ(obj.max(), key_type(count * 4 + 1));
+    }
+}
+
+TYPED_TEST_P(SerializationFixture, LoadOtherBucketType) {
+    using key_type = typename TypeParam::key_type;
+
+    // The format does not depend on the bucket type.
+    this->fill();
+    std::istringstream is(this->save(), std::ios::binary);
+    YFastTrie<key_type, RedBlackTree<key_type>> obj;
+    ASSERT_TRUE(obj.load(is));
+    EXPECT_EQ(std::vector<key_type>(obj.begin(), obj.end()), this->keys_);
+}
+
+TYPED_TEST_P(SerializationFixture, LoadRejectsCorruption) {
+    this->fill();
+    auto data = this->save();
+
+    // Flip one bit in the header, the keys and the checksum.
+    for (size_t offset : {size_t(4), data.size() / 2, data.size() - 1}) {
+        auto corrupted = data;
+        corrupted[offset] ^= 1;
+        this->check_rejected(corrupted);
+    }
+}
+
+TYPED_TEST_P(SerializationFixture, LoadRejectsTruncation) {
+    this->fill();
+    auto data = this->save();
+    for (size_t size : {size_t(0), size_t(8), data.size() / 2, data.size() - 1})
+        this->check_rejected(data.substr(0, size));
+}
+
+TYPED_TEST_P(SerializationFixture, LoadRejectsOtherKeyType) {
+    using key_type = typename TypeParam::key_type;
+    using other_key_type = typename std::conditional<sizeof(key_type) == 8, uint32_t, uint64_t>::type;
+
+    YFastTrie<other_key_type> other;
+    other.insert(1);
+    std::ostringstream os(std::ios::binary);
+    other.save(os);
+    this->check_rejected(os.str());
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SerializationFixture,
+    SaveLoadEmpty, SaveLoadSomeKeys, UpdateAfterLoad, LoadOtherBucketType, LoadRejectsCorruption,
+    LoadRejectsTruncation, LoadRejectsOtherKeyType);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SerializationFixture);
@@ -0,0 +1,17 @@
+/**
+ * @file test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/frozen-y-fast-trie/frozen-y-fast-trie.h"
+
+template <typename Key_>
+using SimdFrozenYFastTrie = FrozenYFastTrie<Key_, SimdSearch>;
+
+DEFINE_FROZEN_TESTS(FrozenYFastTrie);
+DEFINE_FROZEN_TESTS(SimdFrozenYFastTrie);
+TEST_MAIN();
\ No newline at end of file
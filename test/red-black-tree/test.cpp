@@ -9,6 +9,9 @@
 #include "../fixtures/fixtures.h"
 #include "../../src/red-black-tree/red-black-tree.h"
 
+template <typename Key_>
+using CountingRedBlackTree = RedBlackTree<Key_, NodePool, OperationStats>;
+
 DEFINE_SIZE_TESTS(RedBlackTree);
 DEFINE_CONTAINS_TESTS(RedBlackTree);
 DEFINE_PREDECESSOR_TESTS(RedBlackTree);
@@ -17,4 +20,7 @@ DEFINE_MIN_TESTS(RedBlackTree);
 DEFINE_MAX_TESTS(RedBlackTree);
 DEFINE_INSERT_TESTS(RedBlackTree);
 DEFINE_REMOVE_TESTS(RedBlackTree);
+DEFINE_ORDER_STATISTIC_TESTS(RedBlackTree);
+DEFINE_MEMORY_TESTS(RedBlackTree);
+DEFINE_OPERATION_STATS_TESTS(CountingRedBlackTree);
 TEST_MAIN();
\ No newline at end of file
@@ -0,0 +1,13 @@
+/**
+ * @file concurrency.test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/sharded-y-fast-trie/sharded-y-fast-trie.h"
+
+DEFINE_CONCURRENCY_TESTS(ShardedYFastTrie);
+TEST_MAIN();
\ No newline at end of file
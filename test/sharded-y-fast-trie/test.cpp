@@ -0,0 +1,48 @@
+/**
+ * @file test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/sharded-y-fast-trie/sharded-y-fast-trie.h"
+#include "../../src/sorted-array-bucket/sorted-array-bucket.h"
+
+template <typename Key_>
+using OneShardYFastTrie = ShardedYFastTrie<Key_, 1>;
+
+template <typename Key_>
+using SortedArrayShardedYFastTrie = ShardedYFastTrie<Key_, 256, SortedArrayBucket<Key_>>;
+
+DEFINE_SIZE_TESTS(ShardedYFastTrie);
+DEFINE_CONTAINS_TESTS(ShardedYFastTrie);
+DEFINE_PREDECESSOR_TESTS(ShardedYFastTrie);
+DEFINE_SUCCESSOR_TESTS(ShardedYFastTrie);
+DEFINE_MIN_TESTS(ShardedYFastTrie);
+DEFINE_MAX_TESTS(ShardedYFastTrie);
+DEFINE_INSERT_TESTS(ShardedYFastTrie);
+DEFINE_REMOVE_TESTS(ShardedYFastTrie);
+DEFINE_CONCURRENCY_TESTS(ShardedYFastTrie);
+
+DEFINE_SIZE_TESTS(OneShardYFastTrie);
+DEFINE_CONTAINS_TESTS(OneShardYFastTrie);
+DEFINE_PREDECESSOR_TESTS(OneShardYFastTrie);
+DEFINE_SUCCESSOR_TESTS(OneShardYFastTrie);
+DEFINE_MIN_TESTS(OneShardYFastTrie);
+DEFINE_MAX_TESTS(OneShardYFastTrie);
+DEFINE_INSERT_TESTS(OneShardYFastTrie);
+DEFINE_REMOVE_TESTS(OneShardYFastTrie);
+DEFINE_CONCURRENCY_TESTS(OneShardYFastTrie);
+
+DEFINE_SIZE_TESTS(SortedArrayShardedYFastTrie);
+DEFINE_CONTAINS_TESTS(SortedArrayShardedYFastTrie);
+DEFINE_PREDECESSOR_TESTS(SortedArrayShardedYFastTrie);
+DEFINE_SUCCESSOR_TESTS(SortedArrayShardedYFastTrie);
+DEFINE_MIN_TESTS(SortedArrayShardedYFastTrie);
+DEFINE_MAX_TESTS(SortedArrayShardedYFastTrie);
+DEFINE_INSERT_TESTS(SortedArrayShardedYFastTrie);
+DEFINE_REMOVE_TESTS(SortedArrayShardedYFastTrie);
+DEFINE_CONCURRENCY_TESTS(SortedArrayShardedYFastTrie);
+TEST_MAIN();
\ No newline at end of file
@@ -0,0 +1,16 @@
+/**
+ * @file order-statistic.test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/sorted-array-bucket/sorted-array-bucket.h"
+
+template <typename Key_>
+using SortedArrayBucketMaxKeys = SortedArrayBucket<Key_, MAX_KEYS>;
+
+DEFINE_ORDER_STATISTIC_TESTS(SortedArrayBucketMaxKeys);
+TEST_MAIN();
\ No newline at end of file
@@ -0,0 +1,11 @@
+/**
+ * @file search.test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-16
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../fixtures/search-fixture.h"
+TEST_MAIN();
\ No newline at end of file
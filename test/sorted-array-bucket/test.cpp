@@ -0,0 +1,38 @@
+/**
+ * @file test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-16
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../fixtures/search-fixture.h"
+#include "../../src/sorted-array-bucket/sorted-array-bucket.h"
+
+template <typename Key_>
+using SortedArrayBucketMaxKeys = SortedArrayBucket<Key_, MAX_KEYS>;
+
+template <typename Key_>
+using SimdSortedArrayBucketMaxKeys = SortedArrayBucket<Key_, MAX_KEYS, SimdSearch>;
+
+DEFINE_SIZE_TESTS(SortedArrayBucketMaxKeys);
+DEFINE_CONTAINS_TESTS(SortedArrayBucketMaxKeys);
+DEFINE_PREDECESSOR_TESTS(SortedArrayBucketMaxKeys);
+DEFINE_SUCCESSOR_TESTS(SortedArrayBucketMaxKeys);
+DEFINE_MIN_TESTS(SortedArrayBucketMaxKeys);
+DEFINE_MAX_TESTS(SortedArrayBucketMaxKeys);
+DEFINE_INSERT_TESTS(SortedArrayBucketMaxKeys);
+DEFINE_REMOVE_TESTS(SortedArrayBucketMaxKeys);
+DEFINE_ORDER_STATISTIC_TESTS(SortedArrayBucketMaxKeys);
+
+DEFINE_SIZE_TESTS(SimdSortedArrayBucketMaxKeys);
+DEFINE_CONTAINS_TESTS(SimdSortedArrayBucketMaxKeys);
+DEFINE_PREDECESSOR_TESTS(SimdSortedArrayBucketMaxKeys);
+DEFINE_SUCCESSOR_TESTS(SimdSortedArrayBucketMaxKeys);
+DEFINE_MIN_TESTS(SimdSortedArrayBucketMaxKeys);
+DEFINE_MAX_TESTS(SimdSortedArrayBucketMaxKeys);
+DEFINE_INSERT_TESTS(SimdSortedArrayBucketMaxKeys);
+DEFINE_REMOVE_TESTS(SimdSortedArrayBucketMaxKeys);
+DEFINE_ORDER_STATISTIC_TESTS(SimdSortedArrayBucketMaxKeys);
+TEST_MAIN();
\ No newline at end of file
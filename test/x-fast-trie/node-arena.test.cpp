@@ -0,0 +1,23 @@
+/**
+ * @file node-arena.test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/x-fast-trie/x-fast-trie.h"
+
+TEST(NodeArena, MaxSizeMatchesNodeLinks) {
+    // Every handle the arena hands out must fit in a child link next to the skip link bit.
+    EXPECT_EQ(NodeArena<XFastTrieNode<>>::max_size(), XFastTrieNode<>::max_handle);
+    EXPECT_EQ((NodeArena<XFastTrieLeaf<uint64_t, void>>::max_size()), XFastTrieNode<>::max_handle);
+    EXPECT_EQ((NodeArena<XFastTrieLeaf<uint32_t, int*>>::max_size()), XFastTrieNode<>::max_handle);
+}
+
+TEST(NodeArena, MaxSizeWithoutLinks) {
+    EXPECT_EQ(NodeArena<uint64_t>::max_size(), std::numeric_limits<uint32_t>::max());
+}
+
+TEST_MAIN();
\ No newline at end of file
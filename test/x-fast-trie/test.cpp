@@ -9,6 +9,9 @@
 #include "../fixtures/fixtures.h"
 #include "../../src/x-fast-trie/x-fast-trie.h"
 
+template <typename Key_>
+using CountingXFastTrie = XFastTrie<Key_, flat_map, NodeArena, void, OperationStats>;
+
 DEFINE_SIZE_TESTS(XFastTrie);
 DEFINE_CONTAINS_TESTS(XFastTrie);
 DEFINE_PREDECESSOR_TESTS(XFastTrie);
@@ -17,4 +20,8 @@ DEFINE_MIN_TESTS(XFastTrie);
 DEFINE_MAX_TESTS(XFastTrie);
 DEFINE_INSERT_TESTS(XFastTrie);
 DEFINE_REMOVE_TESTS(XFastTrie);
+DEFINE_BATCH_TESTS(XFastTrie);
+DEFINE_BULK_LOAD_TESTS(XFastTrie);
+DEFINE_MEMORY_TESTS(XFastTrie);
+DEFINE_OPERATION_STATS_TESTS(CountingXFastTrie);
 TEST_MAIN();
\ No newline at end of file
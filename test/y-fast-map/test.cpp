@@ -0,0 +1,17 @@
+/**
+ * @file test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-map/y-fast-map.h"
+#include <memory>
+
+template <typename Key_>
+using UniquePtrYFastMap = YFastMap<Key_, std::unique_ptr<uint64_t>>;
+
+DEFINE_MAP_TESTS(UniquePtrYFastMap);
+TEST_MAIN();
\ No newline at end of file
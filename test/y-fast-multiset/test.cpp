@@ -0,0 +1,21 @@
+/**
+ * @file test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-multiset/y-fast-multiset.h"
+
+template <typename Key_>
+using DefaultYFastMultiset = YFastMultiset<Key_>;
+
+DEFINE_CONTAINS_TESTS(DefaultYFastMultiset);
+DEFINE_PREDECESSOR_TESTS(DefaultYFastMultiset);
+DEFINE_SUCCESSOR_TESTS(DefaultYFastMultiset);
+DEFINE_MIN_TESTS(DefaultYFastMultiset);
+DEFINE_MAX_TESTS(DefaultYFastMultiset);
+DEFINE_MULTISET_TESTS(DefaultYFastMultiset);
+TEST_MAIN();
\ No newline at end of file
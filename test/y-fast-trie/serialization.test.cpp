@@ -0,0 +1,13 @@
+/**
+ * @file serialization.test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-17
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-trie/y-fast-trie.h"
+
+DEFINE_SERIALIZATION_TESTS(YFastTrie);
+TEST_MAIN();
\ No newline at end of file
@@ -0,0 +1,29 @@
+/**
+ * @file simd-sorted-array-bucket.test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-16
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-trie/y-fast-trie.h"
+#include "../../src/sorted-array-bucket/sorted-array-bucket.h"
+
+template <typename Key_>
+using SimdSortedArrayYFastTrie = YFastTrie<Key_, SimdSortedArrayBucket<Key_>>;
+
+DEFINE_SIZE_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_CONTAINS_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_PREDECESSOR_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_SUCCESSOR_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_MIN_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_MAX_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_INSERT_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_REMOVE_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_BATCH_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_BULK_LOAD_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_ITERATOR_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_RANGE_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_ORDER_STATISTIC_TESTS(SimdSortedArrayYFastTrie);
+TEST_MAIN();
\ No newline at end of file
@@ -0,0 +1,29 @@
+/**
+ * @file sorted-array-bucket.test.cpp
+ * @author Calvin Higgins (calvin_higgins2@uri.edu)
+ * @version 1.0
+ * @date 2026-10-16
+ * 
+ */
+
+#include "../fixtures/fixtures.h"
+#include "../../src/y-fast-trie/y-fast-trie.h"
+#include "../../src/sorted-array-bucket/sorted-array-bucket.h"
+
+template <typename Key_>
+using SortedArrayYFastTrie = YFastTrie<Key_, SortedArrayBucket<Key_>>;
+
+DEFINE_SIZE_TESTS(SortedArrayYFastTrie);
+DEFINE_CONTAINS_TESTS(SortedArrayYFastTrie);
+DEFINE_PREDECESSOR_TESTS(SortedArrayYFastTrie);
+DEFINE_SUCCESSOR_TESTS(SortedArrayYFastTrie);
+DEFINE_MIN_TESTS(SortedArrayYFastTrie);
+DEFINE_MAX_TESTS(SortedArrayYFastTrie);
+DEFINE_INSERT_TESTS(SortedArrayYFastTrie);
+DEFINE_REMOVE_TESTS(SortedArrayYFastTrie);
+DEFINE_BATCH_TESTS(SortedArrayYFastTrie);
+DEFINE_BULK_LOAD_TESTS(SortedArrayYFastTrie);
+DEFINE_ITERATOR_TESTS(SortedArrayYFastTrie);
+DEFINE_RANGE_TESTS(SortedArrayYFastTrie);
+DEFINE_ORDER_STATISTIC_TESTS(SortedArrayYFastTrie);
+TEST_MAIN();
\ No newline at end of file
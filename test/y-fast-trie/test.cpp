@@ -8,6 +8,16 @@
 
 #include "../fixtures/fixtures.h"
 #include "../../src/y-fast-trie/y-fast-trie.h"
+#include "../../src/sorted-array-bucket/sorted-array-bucket.h"
+
+template <typename Key_>
+using SortedArrayYFastTrie = YFastTrie<Key_, SortedArrayBucket<Key_>>;
+
+template <typename Key_>
+using SimdSortedArrayYFastTrie = YFastTrie<Key_, SimdSortedArrayBucket<Key_>>;
+
+template <typename Key_>
+using CountingYFastTrie = YFastTrie<Key_, RedBlackTree<Key_>, flat_map, OperationStats>;
 
 DEFINE_SIZE_TESTS(YFastTrie);
 DEFINE_CONTAINS_TESTS(YFastTrie);
@@ -17,4 +27,45 @@ DEFINE_MIN_TESTS(YFastTrie);
 DEFINE_MAX_TESTS(YFastTrie);
 DEFINE_INSERT_TESTS(YFastTrie);
 DEFINE_REMOVE_TESTS(YFastTrie);
+DEFINE_BATCH_TESTS(YFastTrie);
+DEFINE_BULK_LOAD_TESTS(YFastTrie);
+DEFINE_ITERATOR_TESTS(YFastTrie);
+DEFINE_RANGE_TESTS(YFastTrie);
+DEFINE_ORDER_STATISTIC_TESTS(YFastTrie);
+DEFINE_SERIALIZATION_TESTS(YFastTrie);
+DEFINE_MEMORY_TESTS(YFastTrie);
+
+DEFINE_SIZE_TESTS(SortedArrayYFastTrie);
+DEFINE_CONTAINS_TESTS(SortedArrayYFastTrie);
+DEFINE_PREDECESSOR_TESTS(SortedArrayYFastTrie);
+DEFINE_SUCCESSOR_TESTS(SortedArrayYFastTrie);
+DEFINE_MIN_TESTS(SortedArrayYFastTrie);
+DEFINE_MAX_TESTS(SortedArrayYFastTrie);
+DEFINE_INSERT_TESTS(SortedArrayYFastTrie);
+DEFINE_REMOVE_TESTS(SortedArrayYFastTrie);
+DEFINE_BATCH_TESTS(SortedArrayYFastTrie);
+DEFINE_BULK_LOAD_TESTS(SortedArrayYFastTrie);
+DEFINE_ITERATOR_TESTS(SortedArrayYFastTrie);
+DEFINE_RANGE_TESTS(SortedArrayYFastTrie);
+DEFINE_ORDER_STATISTIC_TESTS(SortedArrayYFastTrie);
+DEFINE_SERIALIZATION_TESTS(SortedArrayYFastTrie);
+DEFINE_MEMORY_TESTS(SortedArrayYFastTrie);
+
+DEFINE_SIZE_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_CONTAINS_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_PREDECESSOR_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_SUCCESSOR_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_MIN_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_MAX_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_INSERT_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_REMOVE_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_BATCH_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_BULK_LOAD_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_ITERATOR_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_RANGE_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_ORDER_STATISTIC_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_SERIALIZATION_TESTS(SimdSortedArrayYFastTrie);
+DEFINE_MEMORY_TESTS(SimdSortedArrayYFastTrie);
+
+DEFINE_OPERATION_STATS_TESTS(CountingYFastTrie);
 TEST_MAIN();
\ No newline at end of file